@@ -0,0 +1,1277 @@
+// Benchmarks of VisualNodeSystemCore with checks of their results.
+// Every section prints its timings, program returns non-zero exit code if any check failed.
+#include "../VisualNodeSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+using namespace VisNodeSys;
+
+static int FailedChecks = 0;
+
+#define BENCHMARK_CHECK(Condition)                                              \
+	do                                                                          \
+	{                                                                           \
+		if (!(Condition))                                                       \
+		{                                                                       \
+			std::printf("  check failed: %s (line %d)\n", #Condition, __LINE__); \
+			FailedChecks++;                                                     \
+		}                                                                       \
+	} while (false)
+
+typedef std::chrono::steady_clock BenchmarkClock;
+
+// Every allocation of program is counted, sections read difference around measured code.
+static std::atomic<size_t> AllocationCount(0);
+
+void* operator new(const std::size_t Size)
+{
+	AllocationCount++;
+	void* Result = std::malloc(Size == 0 ? 1 : Size);
+	if (Result == nullptr)
+		throw std::bad_alloc();
+
+	return Result;
+}
+
+void operator delete(void* Pointer) noexcept
+{
+	std::free(Pointer);
+}
+
+void operator delete(void* Pointer, std::size_t) noexcept
+{
+	std::free(Pointer);
+}
+
+static double MillisecondsSince(const BenchmarkClock::time_point Start)
+{
+	return std::chrono::duration<double, std::milli>(BenchmarkClock::now() - Start).count();
+}
+
+// Adds Bias to sum of its inputs. Event driven variant computes on EXECUTE and passes EXECUTE to connected nodes,
+// plan variant has typed output and execute function.
+class SumNode : public Node
+{
+	double Value = 0.0;
+	double Bias = 0.0;
+
+	static void Execute(Node* Node, const void* const* Inputs, void* const* Outputs)
+	{
+		double Result = static_cast<SumNode*>(Node)->Bias;
+		for (size_t i = 0; i < 2; i++)
+		{
+			if (Inputs[i] != nullptr)
+				Result += *static_cast<const double*>(Inputs[i]);
+		}
+
+		*static_cast<double*>(Outputs[0]) = Result;
+	}
+
+	// Node without connected inputs adds index of instance, so every lane has different values.
+	static void ExecuteBatch(Node* Node, const void* const* Inputs, void* const* Outputs, const size_t FirstInstance, const size_t LaneCount)
+	{
+		const double Bias = static_cast<SumNode*>(Node)->Bias;
+		double* Result = static_cast<double*>(Outputs[0]);
+		for (size_t j = 0; j < LaneCount; j++)
+		{
+			Result[j] = Bias;
+			if (Inputs[0] == nullptr && Inputs[1] == nullptr)
+				Result[j] += static_cast<double>(FirstInstance + j);
+		}
+
+		for (size_t i = 0; i < 2; i++)
+		{
+			if (Inputs[i] == nullptr)
+				continue;
+
+			const double* InputLanes = static_cast<const double*>(Inputs[i]);
+			for (size_t j = 0; j < LaneCount; j++)
+				Result[j] += InputLanes[j];
+		}
+	}
+public:
+	SumNode(const double Bias, const bool bPlanned) : Bias(Bias)
+	{
+		Type = "SumNode";
+		AddSocket(new NodeSocket(this, "double", "A", false));
+		AddSocket(new NodeSocket(this, "double", "B", false));
+		AddSocket(new NodeSocket(this, "double", "Out", true));
+
+		if (bPlanned)
+		{
+			Output[0]->SetDataFunction<double>(std::function<double()>());
+			SetExecuteFunction(Execute);
+			SetBatchExecuteFunction(ExecuteBatch);
+		}
+		else
+		{
+			Output[0]->SetFunctionToOutputData([this]() -> void* { return &Value; });
+		}
+	}
+
+	void SocketEvent(NodeSocket*, NodeSocket*, const NODE_SOCKET_EVENT EventType) override
+	{
+		if (EventType != EXECUTE)
+			return;
+
+		Value = Bias;
+		for (size_t i = 0; i < Input.size(); i++)
+		{
+			const std::vector<NodeSocket*> ConnectedSockets = Input[i]->GetConnectedSockets();
+			if (!ConnectedSockets.empty())
+				Value += *static_cast<const double*>(ConnectedSockets[0]->GetData());
+		}
+
+		const std::vector<NodeSocket*> ConnectedSockets = Output[0]->GetConnectedSockets();
+		for (size_t i = 0; i < ConnectedSockets.size(); i++)
+			GetParentArea()->TriggerSocketEvent(Output[0], ConnectedSockets[i], EXECUTE);
+	}
+
+	double GetValue() const { return Value; }
+	void SetBias(const double NewValue) { Bias = NewValue; }
+	NodeSocket* GetInput(const size_t Index) const { return Input[Index]; }
+	NodeSocket* GetOutput(const size_t Index) const { return Output[Index]; }
+};
+
+// Appends its tag to log on every EXECUTE and passes EXECUTE to connected nodes.
+class CounterNode : public Node
+{
+	int Tag = 0;
+	std::vector<int>* Log = nullptr;
+	Node* NodeToDelete = nullptr;
+public:
+	CounterNode(const int Tag, std::vector<int>* Log) : Tag(Tag), Log(Log)
+	{
+		AddSocket(new NodeSocket(this, "EXECUTE", "In", false));
+		AddSocket(new NodeSocket(this, "EXECUTE", "Out", true));
+	}
+
+	void SocketEvent(NodeSocket*, NodeSocket*, const NODE_SOCKET_EVENT EventType) override
+	{
+		if (EventType != EXECUTE)
+			return;
+
+		Log->push_back(Tag);
+		if (NodeToDelete != nullptr)
+		{
+			GetParentArea()->DeleteNode(NodeToDelete);
+			NodeToDelete = nullptr;
+		}
+
+		const std::vector<NodeSocket*> ConnectedSockets = Output[0]->GetConnectedSockets();
+		for (size_t i = 0; i < ConnectedSockets.size(); i++)
+			GetParentArea()->TriggerSocketEvent(Output[0], ConnectedSockets[i], EXECUTE);
+	}
+
+	// Node is deleted on next EXECUTE.
+	void SetNodeToDelete(Node* NewValue) { NodeToDelete = NewValue; }
+	NodeSocket* GetInput(const size_t Index) const { return Input[Index]; }
+	NodeSocket* GetOutput(const size_t Index) const { return Output[Index]; }
+};
+
+// Refines square root of its input with many iterations, so that execution time is dominated by node itself.
+// Does not pass EXECUTE further, NodeEvaluator is expected to run it.
+class ComputeNode : public Node
+{
+	double Value = 0.0;
+	int Iterations = 0;
+public:
+	ComputeNode(const int Iterations) : Iterations(Iterations)
+	{
+		AddSocket(new NodeSocket(this, "double", "In", false));
+		AddSocket(new NodeSocket(this, "double", "Out", true));
+		Output[0]->SetFunctionToOutputData([this]() -> void* { return &Value; });
+		SetIsThreadSafe(true);
+	}
+
+	void SocketEvent(NodeSocket*, NodeSocket*, const NODE_SOCKET_EVENT EventType) override
+	{
+		if (EventType != EXECUTE)
+			return;
+
+		double Result = 2.0;
+		const std::vector<NodeSocket*> ConnectedSockets = Input[0]->GetConnectedSockets();
+		if (!ConnectedSockets.empty())
+			Result += *static_cast<const double*>(ConnectedSockets[0]->GetData());
+
+		for (int i = 0; i < Iterations; i++)
+			Result = std::sqrt(Result + 2.0);
+
+		Value = Result;
+	}
+
+	double GetValue() const { return Value; }
+};
+
+static size_t CountInLog(const std::vector<int>& Log, const int Tag)
+{
+	size_t Result = 0;
+	for (size_t i = 0; i < Log.size(); i++)
+	{
+		if (Log[i] == Tag)
+			Result++;
+	}
+
+	return Result;
+}
+
+// ChainCount chains of ChainLength nodes, first node of every chain is returned in Heads.
+static std::vector<SumNode*> BuildChains(NodeArea* Area, const size_t ChainCount, const size_t ChainLength, const bool bPlanned, std::vector<SumNode*>& Heads)
+{
+	std::vector<SumNode*> Tails;
+	Area->BeginBatch(ChainCount * ChainLength, ChainCount * ChainLength);
+	for (size_t i = 0; i < ChainCount; i++)
+	{
+		SumNode* Previous = nullptr;
+		for (size_t j = 0; j < ChainLength; j++)
+		{
+			SumNode* NewNode = new SumNode(static_cast<double>(i + 1), bPlanned);
+			Area->AddNode(NewNode);
+			if (Previous != nullptr)
+				Area->TryToConnect(Previous, 0, NewNode, 0);
+			else
+				Heads.push_back(NewNode);
+
+			Previous = NewNode;
+		}
+
+		Tails.push_back(Previous);
+	}
+	Area->EndBatch();
+
+	return Tails;
+}
+
+// Nodes of chain that starts with Head, in order.
+static std::vector<SumNode*> GetChain(SumNode* Head)
+{
+	std::vector<SumNode*> Result;
+	while (Head != nullptr)
+	{
+		Result.push_back(Head);
+		const std::vector<NodeSocket*> ConnectedSockets = Head->GetOutput(0)->GetConnectedSockets();
+		Head = ConnectedSockets.empty() ? nullptr : static_cast<SumNode*>(ConnectedSockets[0]->GetParent());
+	}
+
+	return Result;
+}
+
+// Per evaluation overhead of NodeExecutionPlan against event driven execution of the same graph.
+static void BenchmarkExecutionPlan()
+{
+	std::printf("NodeExecutionPlan against event driven execution\n");
+	const size_t ChainCount = 10;
+	const size_t ChainLength = 100;
+	const int Runs = 200;
+
+	NodeArea* EventArea = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> EventHeads;
+	const std::vector<SumNode*> EventTails = BuildChains(EventArea, ChainCount, ChainLength, false, EventHeads);
+
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+	{
+		for (size_t i = 0; i < EventHeads.size(); i++)
+			EventArea->TriggerOrphanSocketEvent(EventHeads[i], EXECUTE);
+		EventArea->Update();
+	}
+	const double EventTime = MillisecondsSince(Start) / Runs;
+
+	NodeArea* PlanArea = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> PlanHeads;
+	const std::vector<SumNode*> PlanTails = BuildChains(PlanArea, ChainCount, ChainLength, true, PlanHeads);
+
+	NodeExecutionPlan Plan(PlanArea);
+	Start = BenchmarkClock::now();
+	BENCHMARK_CHECK(Plan.Compile());
+	const double CompileTime = MillisecondsSince(Start);
+
+	Start = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+		Plan.Execute();
+	const double PlanTime = MillisecondsSince(Start) / Runs;
+
+	// Steps follow topological order, so chains are found through values of their tails.
+	const std::vector<NodeExecutionStep>& Steps = Plan.GetSteps();
+	BENCHMARK_CHECK(Steps.size() == ChainCount * ChainLength);
+	for (size_t i = 0; i < ChainCount; i++)
+	{
+		BENCHMARK_CHECK(EventTails[i]->GetValue() == static_cast<double>((i + 1) * ChainLength));
+
+		const double* PlanValue = PlanTails[i]->GetOutput(0)->GetValue<double>();
+		BENCHMARK_CHECK(PlanValue != nullptr && *PlanValue == EventTails[i]->GetValue());
+	}
+
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (Steps[i].TargetNode == PlanTails[0])
+			BENCHMARK_CHECK(*static_cast<const double*>(Plan.GetOutputValue(i, 0)) == EventTails[0]->GetValue());
+	}
+
+	const size_t NodeCount = ChainCount * ChainLength;
+	std::printf("  event driven: %.1f ns per node\n", EventTime * 1e6 / NodeCount);
+	std::printf("  compiled plan: %.1f ns per node, compile %.3f ms, %.1fx faster\n", PlanTime * 1e6 / NodeCount, CompileTime, EventTime / PlanTime);
+
+	// Topology change makes plan compile again.
+	BENCHMARK_CHECK(PlanArea->TryToDisconnect(PlanHeads[0], 0, PlanHeads[0]->GetOutput(0)->GetConnectedSockets()[0]->GetParent(), 0));
+	BENCHMARK_CHECK(!Plan.IsUpToDate());
+	BENCHMARK_CHECK(Plan.Execute() && Plan.IsUpToDate());
+	BENCHMARK_CHECK(*PlanTails[0]->GetOutput(0)->GetValue<double>() == static_cast<double>(ChainLength - 1));
+
+	NODE_SYSTEM.DeleteNodeArea(EventArea);
+	NODE_SYSTEM.DeleteNodeArea(PlanArea);
+}
+
+// ExecuteBatch against event driven execution of every instance, and lane memory with and without buffer reuse.
+static void BenchmarkBatchExecution()
+{
+	std::printf("NodeExecutionPlan::ExecuteBatch against event driven execution\n");
+	const size_t ChainCount = 10;
+	const size_t ChainLength = 100;
+	const size_t LaneCount = 256;
+
+	// Instance k is event driven graph whose heads have Bias increased by k.
+	NodeArea* EventArea = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> EventHeads;
+	const std::vector<SumNode*> EventTails = BuildChains(EventArea, ChainCount, ChainLength, false, EventHeads);
+
+	std::vector<double> Expected(ChainCount * LaneCount);
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (size_t Lane = 0; Lane < LaneCount; Lane++)
+	{
+		for (size_t i = 0; i < EventHeads.size(); i++)
+		{
+			EventHeads[i]->SetBias(static_cast<double>(i + 1 + Lane));
+			EventArea->TriggerOrphanSocketEvent(EventHeads[i], EXECUTE);
+		}
+		EventArea->Update();
+
+		for (size_t i = 0; i < EventTails.size(); i++)
+			Expected[i * LaneCount + Lane] = EventTails[i]->GetValue();
+	}
+	const double EventTime = MillisecondsSince(Start);
+
+	NodeArea* PlanArea = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> PlanHeads;
+	const std::vector<SumNode*> PlanTails = BuildChains(PlanArea, ChainCount, ChainLength, true, PlanHeads);
+
+	// Every third node of chain is executed lane by lane with its execute function.
+	for (size_t i = 0; i < PlanHeads.size(); i++)
+	{
+		const std::vector<SumNode*> Chain = GetChain(PlanHeads[i]);
+		for (size_t j = 2; j < Chain.size(); j += 3)
+			Chain[j]->SetBatchExecuteFunction(nullptr);
+	}
+
+	NodeExecutionPlan Plan(PlanArea);
+	BENCHMARK_CHECK(Plan.Compile());
+	std::vector<size_t> TailSteps;
+	for (size_t i = 0; i < PlanTails.size(); i++)
+	{
+		for (size_t j = 0; j < Plan.GetSteps().size(); j++)
+		{
+			if (Plan.GetSteps()[j].TargetNode == PlanTails[i])
+				TailSteps.push_back(j);
+		}
+	}
+	BENCHMARK_CHECK(TailSteps.size() == ChainCount);
+
+	for (int Reuse = 0; Reuse < 2; Reuse++)
+	{
+		Plan.SetReusingLaneBuffers(Reuse == 1);
+		Start = BenchmarkClock::now();
+		BENCHMARK_CHECK(Plan.ExecuteBatch(0, LaneCount));
+		const double BatchTime = MillisecondsSince(Start);
+
+		size_t Mismatches = 0;
+		for (size_t i = 0; i < TailSteps.size(); i++)
+		{
+			const double* Lanes = static_cast<const double*>(Plan.GetOutputLanes(TailSteps[i], 0));
+			BENCHMARK_CHECK(Lanes != nullptr);
+			for (size_t Lane = 0; Lanes != nullptr && Lane < LaneCount; Lane++)
+			{
+				if (Lanes[Lane] != Expected[i * LaneCount + Lane])
+					Mismatches++;
+			}
+		}
+		BENCHMARK_CHECK(Mismatches == 0);
+
+		std::printf("  %s lane buffer reuse: %.3f ms for %zu lanes (event driven %.3f ms), lane memory %zu bytes\n",
+		            Reuse == 1 ? "with" : "without", BatchTime, LaneCount, EventTime, Plan.GetLaneMemorySize(LaneCount));
+	}
+
+	Plan.SetReusingLaneBuffers(false);
+	const size_t SeparateMemory = Plan.GetLaneMemorySize(LaneCount);
+	Plan.SetReusingLaneBuffers(true);
+	BENCHMARK_CHECK(Plan.GetLaneMemorySize(LaneCount) < SeparateMemory);
+
+	NODE_SYSTEM.DeleteNodeArea(EventArea);
+	NODE_SYSTEM.DeleteNodeArea(PlanArea);
+}
+
+// Abort restores pending socket events and asynchronous tasks of nodes removed inside transaction, commit drops them.
+static void CheckTransactions()
+{
+	std::printf("Transactions\n");
+
+	for (int Commit = 0; Commit < 2; Commit++)
+	{
+		NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+		std::vector<int> Log;
+		CounterNode* Source = new CounterNode(0, &Log);
+		CounterNode* Removed = new CounterNode(1, &Log);
+		Area->AddNode(Source);
+		Area->AddNode(Removed);
+		BENCHMARK_CHECK(Area->TryToConnect(Source, 0, Removed, 0));
+
+		bool bCompleted = false;
+		BENCHMARK_CHECK(Area->TriggerSocketEvent(Source->GetOutput(0), Removed->GetInput(0), EXECUTE));
+		BENCHMARK_CHECK(Area->RunAsync(Removed, [](const std::atomic<bool>&) {}, [&bCompleted]() { bCompleted = true; }));
+
+		Area->MarkDirty(Removed);
+		BENCHMARK_CHECK(Area->AddRerouteNodeToConnection(Source, 0, Removed, 0, 0, ImVec2(10.0f, 10.0f)));
+
+		BENCHMARK_CHECK(Area->BeginTransaction());
+		Area->DeleteNode(Removed);
+		BENCHMARK_CHECK(Area->GetNodeCount() == 1);
+		BENCHMARK_CHECK(Commit == 1 ? Area->CommitTransaction() : Area->AbortTransaction());
+		// Abort returns node with its dirty flag.
+		if (Commit == 0)
+			BENCHMARK_CHECK(Area->IsDirty(Removed));
+
+		Area->WaitForAsyncTasks();
+		Area->Update();
+
+		BENCHMARK_CHECK(Area->GetPendingAsyncTaskCount() == 0);
+		if (Commit == 1)
+		{
+			BENCHMARK_CHECK(Area->GetNodeCount() == 1);
+			BENCHMARK_CHECK(!bCompleted);
+			BENCHMARK_CHECK(CountInLog(Log, 1) == 0);
+		}
+		else
+		{
+			BENCHMARK_CHECK(Area->GetNodeCount() == 2);
+			BENCHMARK_CHECK(Area->IsConnected(Source, 0, Removed, 0));
+			BENCHMARK_CHECK(bCompleted);
+			BENCHMARK_CHECK(CountInLog(Log, 1) == 1);
+		}
+
+		std::printf("  %s: %zu nodes, completion %s, %zu events delivered to removed node\n",
+		            Commit == 1 ? "commit" : "abort", Area->GetNodeCount(), bCompleted ? "called" : "dropped", CountInLog(Log, 1));
+		NODE_SYSTEM.DeleteNodeArea(Area);
+	}
+}
+
+// Scheduler delivers events by priority of triggered node or explicit one, equal priorities in order of arrival.
+static void CheckScheduler()
+{
+	std::printf("Socket event scheduler\n");
+	const int EventCount = 20000;
+
+	for (int Scheduled = 0; Scheduled < 2; Scheduled++)
+	{
+		NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+		Area->SetSchedulingSocketEvents(Scheduled == 1);
+		// Every receiver gets more events than default delivery limit allows.
+		Area->SetMaxSocketEventDeliveries(0);
+
+		std::vector<int> Log;
+		CounterNode* Source = new CounterNode(0, &Log);
+		Area->AddNode(Source);
+		const int Priorities[] = { 0, 5, -3, 5 };
+		std::vector<CounterNode*> Receivers;
+		for (int i = 0; i < 4; i++)
+		{
+			Receivers.push_back(new CounterNode(i + 1, &Log));
+			Receivers.back()->SetEventPriority(Priorities[i]);
+			Area->AddNode(Receivers.back());
+			BENCHMARK_CHECK(Area->TryToConnect(Source, 0, Receivers.back(), 0));
+		}
+
+		for (size_t i = 0; i < Receivers.size(); i++)
+			Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[i]->GetInput(0), EXECUTE);
+		Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[2]->GetInput(0), EXECUTE, 10);
+		Area->Update();
+
+		const std::vector<int> Expected = Scheduled == 1 ? std::vector<int>{ 3, 2, 4, 1, 3 } : std::vector<int>{ 1, 2, 3, 4, 3 };
+		BENCHMARK_CHECK(Log == Expected);
+
+		Log.clear();
+		Log.reserve(EventCount);
+		const BenchmarkClock::time_point Start = BenchmarkClock::now();
+		for (int i = 0; i < EventCount; i++)
+			Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[i % Receivers.size()]->GetInput(0), EXECUTE);
+		Area->Update();
+		const double Time = MillisecondsSince(Start);
+		BENCHMARK_CHECK(Log.size() == static_cast<size_t>(EventCount));
+
+		std::printf("  %s: %.1f ns per event\n", Scheduled == 1 ? "scheduled" : "in order of arrival", Time * 1e6 / EventCount);
+		NODE_SYSTEM.DeleteNodeArea(Area);
+	}
+}
+
+// Endless event loop between two nodes is cut by delivery limit, reported as cycle and continued by next Update.
+static void CheckEventStormLimit()
+{
+	std::printf("Socket event delivery limit\n");
+	const size_t Limit = 1000;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	Area->SetMaxSocketEventDeliveries(Limit);
+	std::vector<NodeAreaEventStormReport> Reports;
+	Area->SetEventStormCallback([&Reports](const NodeAreaEventStormReport& Report) { Reports.push_back(Report); });
+
+	std::vector<int> Log;
+	CounterNode* First = new CounterNode(0, &Log);
+	CounterNode* Second = new CounterNode(1, &Log);
+	Area->AddNode(First);
+	Area->AddNode(Second);
+	BENCHMARK_CHECK(Area->TryToConnect(First, 0, Second, 0));
+	BENCHMARK_CHECK(Area->TryToConnect(Second, 0, First, 0));
+
+	Area->TriggerOrphanSocketEvent(First, EXECUTE);
+	const BenchmarkClock::time_point Start = BenchmarkClock::now();
+	Area->Update();
+	const double Time = MillisecondsSince(Start);
+
+	BENCHMARK_CHECK(Reports.size() == 1);
+	BENCHMARK_CHECK(!Reports.empty() && Reports[0].bCycle && Reports[0].Deliveries >= Limit && Reports[0].Path.size() >= 2);
+	BENCHMARK_CHECK(Area->GetDeferredSocketEventCount() == 1);
+	BENCHMARK_CHECK(CountInLog(Log, 0) <= Limit + 1 && CountInLog(Log, 1) <= Limit);
+
+	// Loop goes on in next Update and ends once it is disconnected.
+	const size_t DeliveredBefore = Log.size();
+	Area->Update();
+	BENCHMARK_CHECK(Log.size() > DeliveredBefore && Reports.size() == 2);
+
+	BENCHMARK_CHECK(Area->TryToDisconnect(Second, 0, First, 0));
+	Area->Update();
+	Area->Update();
+	BENCHMARK_CHECK(Area->GetDeferredSocketEventCount() == 0);
+
+	std::printf("  Update with endless loop returned in %.3f ms after %zu deliveries\n", Time, DeliveredBefore);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Plan with target sockets executes only nodes they depend on.
+static void BenchmarkPlanTargets()
+{
+	std::printf("NodeExecutionPlan with targets\n");
+	const size_t ChainCount = 10;
+	const size_t ChainLength = 100;
+	const int Runs = 200;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> Heads;
+	const std::vector<SumNode*> Tails = BuildChains(Area, ChainCount, ChainLength, true, Heads);
+
+	NodeExecutionPlan Plan(Area);
+	Plan.SetTargets({ Tails[3]->GetOutput(0) });
+	BENCHMARK_CHECK(Plan.HasTargets());
+	BENCHMARK_CHECK(Plan.Compile() && Plan.GetSteps().size() == ChainLength);
+
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+		Plan.Execute();
+	const double TargetTime = MillisecondsSince(Start) / Runs;
+
+	BENCHMARK_CHECK(*Tails[3]->GetOutput(0)->GetValue<double>() == static_cast<double>(4 * ChainLength));
+	for (size_t i = 0; i < Tails.size(); i++)
+	{
+		if (i != 3)
+			BENCHMARK_CHECK(Tails[i]->GetOutput(0)->GetDataVersion() == 0);
+	}
+
+	// Input target needs only nodes connected to it.
+	Plan.SetTargets({ Tails[5]->GetInput(0) });
+	BENCHMARK_CHECK(Plan.Compile() && Plan.GetSteps().size() == ChainLength - 1);
+
+	Plan.ClearTargets();
+	BENCHMARK_CHECK(!Plan.HasTargets());
+	BENCHMARK_CHECK(Plan.Compile() && Plan.GetSteps().size() == ChainCount * ChainLength);
+
+	Start = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+		Plan.Execute();
+	const double FullTime = MillisecondsSince(Start) / Runs;
+
+	std::printf("  one of %zu chains: %.3f ms, whole area: %.3f ms, %.1fx faster\n", ChainCount, TargetTime, FullTime, FullTime / TargetTime);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// NodeEvaluator against event driven execution, on calling thread and with thread safe nodes on pool workers.
+static void BenchmarkEvaluator()
+{
+	std::printf("NodeEvaluator against event driven execution\n");
+	const size_t ChainCount = 10;
+	const size_t ChainLength = 100;
+	const size_t NodeCount = ChainCount * ChainLength;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> Heads;
+	const std::vector<SumNode*> Tails = BuildChains(Area, ChainCount, ChainLength, false, Heads);
+
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (size_t i = 0; i < Heads.size(); i++)
+		Area->TriggerOrphanSocketEvent(Heads[i], EXECUTE);
+	Area->Update();
+	const double EventTime = MillisecondsSince(Start);
+
+	ThreadPool Pool(2);
+	for (int Parallel = 0; Parallel < 2; Parallel++)
+	{
+		for (size_t i = 0; i < Heads.size(); i++)
+		{
+			const std::vector<SumNode*> Chain = GetChain(Heads[i]);
+			for (size_t j = 0; j < Chain.size(); j++)
+				Chain[j]->SetIsThreadSafe(Parallel == 1);
+
+			Heads[i]->SetBias(static_cast<double>(i + 2 + Parallel));
+		}
+
+		NodeEvaluator Evaluator(Area, Parallel == 1 ? &Pool : nullptr);
+		Start = BenchmarkClock::now();
+		BENCHMARK_CHECK(Evaluator.Evaluate());
+		const double EvaluatorTime = MillisecondsSince(Start);
+		BENCHMARK_CHECK(Evaluator.GetExecutedNodeCount() == NodeCount);
+
+		for (size_t i = 0; i < Tails.size(); i++)
+			BENCHMARK_CHECK(Tails[i]->GetValue() == static_cast<double>(i + 2 + Parallel + (i + 1) * (ChainLength - 1)));
+
+		std::printf("  %s: %.3f ms, event driven %.3f ms\n", Parallel == 1 ? "thread safe nodes on 2 workers" : "calling thread", EvaluatorTime, EventTime);
+
+		// Nodes still passed EXECUTE to each other.
+		Area->Update();
+	}
+
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Wide graph of compute heavy nodes evaluated with growing number of workers.
+static void BenchmarkEvaluatorScaling()
+{
+	std::printf("NodeEvaluator worker scaling\n");
+	const size_t ChainCount = 256;
+	const size_t ChainLength = 16;
+	const int Iterations = 2000;
+	const size_t MaxWorkerCount = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<ComputeNode*> Tails;
+	Area->BeginBatch(ChainCount * ChainLength, ChainCount * ChainLength);
+	for (size_t i = 0; i < ChainCount; i++)
+	{
+		ComputeNode* Previous = nullptr;
+		for (size_t j = 0; j < ChainLength; j++)
+		{
+			ComputeNode* NewNode = new ComputeNode(Iterations);
+			Area->AddNode(NewNode);
+			if (Previous != nullptr)
+				Area->TryToConnect(Previous, 0, NewNode, 0);
+
+			Previous = NewNode;
+		}
+
+		Tails.push_back(Previous);
+	}
+	Area->EndBatch();
+
+	NodeEvaluator SerialEvaluator(Area);
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	BENCHMARK_CHECK(SerialEvaluator.Evaluate());
+	const double SerialTime = MillisecondsSince(Start);
+	const double Expected = Tails[0]->GetValue();
+	std::printf("  %zu nodes, calling thread: %.3f ms\n", ChainCount * ChainLength, SerialTime);
+
+	for (size_t WorkerCount = 1; WorkerCount <= MaxWorkerCount; WorkerCount++)
+	{
+		ThreadPool Pool(WorkerCount);
+		NodeEvaluator Evaluator(Area, &Pool);
+		Start = BenchmarkClock::now();
+		BENCHMARK_CHECK(Evaluator.Evaluate());
+		const double Time = MillisecondsSince(Start);
+		BENCHMARK_CHECK(Evaluator.GetExecutedNodeCount() == ChainCount * ChainLength);
+
+		for (size_t i = 0; i < Tails.size(); i++)
+			BENCHMARK_CHECK(Tails[i]->GetValue() == Expected);
+
+		std::printf("  %zu workers: %.3f ms, %.2fx speedup\n", WorkerCount, Time, SerialTime / Time);
+	}
+
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Box selection of large area and deletion of selected nodes together with their connections.
+static void BenchmarkBoxSelection()
+{
+	std::printf("Box selection\n");
+	const size_t ColumnCount = 250;
+	const size_t RowCount = 200;
+	const size_t NodeCount = ColumnCount * RowCount;
+	const float Spacing = 300.0f;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<int> Log;
+	std::vector<CounterNode*> Nodes;
+	Area->BeginBatch(NodeCount, NodeCount);
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		Nodes.push_back(new CounterNode(static_cast<int>(i), &Log));
+		Nodes.back()->SetPosition(ImVec2(static_cast<float>(i % ColumnCount) * Spacing, static_cast<float>(i / ColumnCount) * Spacing));
+		Nodes.back()->SetSize(ImVec2(200.0f, 100.0f));
+		Area->AddNode(Nodes.back());
+
+		// Every node is connected to its left neighbour, so deletion also removes connections that cross selection border.
+		if (i % ColumnCount != 0)
+			Area->TryToConnect(Nodes[i - 1], 0, Nodes[i], 0);
+	}
+	Area->EndBatch();
+
+	BenchmarkClock::time_point Start = BenchmarkClock::now();
+	Area->SelectNodesInRegion(ImVec2(-1.0f, -1.0f), ImVec2(ColumnCount * Spacing, RowCount * Spacing));
+	const double SelectAllTime = MillisecondsSince(Start);
+	BENCHMARK_CHECK(Area->GetSelected().size() == NodeCount);
+
+	// Left half of columns.
+	Start = BenchmarkClock::now();
+	Area->SelectNodesInRegion(ImVec2(-1.0f, -1.0f), ImVec2(ColumnCount / 2 * Spacing - 1.0f, RowCount * Spacing));
+	const double SelectHalfTime = MillisecondsSince(Start);
+	BENCHMARK_CHECK(Area->GetSelected().size() == NodeCount / 2);
+	const std::vector<Node*> Selected = Area->GetSelected();
+	BENCHMARK_CHECK(std::find(Selected.begin(), Selected.end(), Nodes[ColumnCount / 2 - 1]) != Selected.end());
+	BENCHMARK_CHECK(std::find(Selected.begin(), Selected.end(), Nodes[ColumnCount / 2]) == Selected.end());
+
+	Start = BenchmarkClock::now();
+	Area->DeleteNodes(Selected);
+	const double DeleteTime = MillisecondsSince(Start);
+	BENCHMARK_CHECK(Area->GetSelected().empty());
+	BENCHMARK_CHECK(Area->GetNodeCount() == NodeCount / 2);
+	BENCHMARK_CHECK(Nodes[ColumnCount / 2]->GetInput(0)->GetConnectedSockets().empty());
+
+	std::printf("  %zu nodes: select all %.3f ms, select half %.3f ms, delete selected %.3f ms\n", NodeCount, SelectAllTime, SelectHalfTime, DeleteTime);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Every thread builds, saves and loads graphs in its own NodeContext, throughput with growing number of threads.
+static void BenchmarkContextScaling()
+{
+	std::printf("NodeContext thread scaling\n");
+	const size_t GraphNodeCount = 200;
+	const int GraphsPerThread = 10;
+	const size_t MaxThreadCount = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+
+	double SingleThreadThroughput = 0.0;
+	for (size_t ThreadCount = 1; ThreadCount <= MaxThreadCount; ThreadCount++)
+	{
+		std::atomic<int> LoadedGraphs(0);
+		std::vector<std::thread> Threads;
+		const BenchmarkClock::time_point Start = BenchmarkClock::now();
+		for (size_t i = 0; i < ThreadCount; i++)
+		{
+			Threads.emplace_back([&LoadedGraphs, GraphNodeCount, GraphsPerThread]() {
+				NodeContext Context;
+				Context.GetFactory().RegisterNodeType("SumNode", []() -> Node* { return new SumNode(0.0, false); }, [](const Node&) -> Node* { return new SumNode(0.0, false); });
+
+				for (int Graph = 0; Graph < GraphsPerThread; Graph++)
+				{
+					NodeArea Area(&Context);
+					SumNode* Previous = nullptr;
+					for (size_t j = 0; j < GraphNodeCount; j++)
+					{
+						SumNode* NewNode = new SumNode(static_cast<double>(j), false);
+						Area.AddNode(NewNode);
+						if (Previous != nullptr)
+							Area.TryToConnect(Previous, 0, NewNode, 0);
+
+						Previous = NewNode;
+					}
+
+					NodeArea LoadedArea(&Context);
+					LoadedArea.LoadFromJson(Area.ToJson());
+					if (LoadedArea.GetNodeCount() == GraphNodeCount)
+						LoadedGraphs++;
+				}
+			});
+		}
+
+		for (size_t i = 0; i < Threads.size(); i++)
+			Threads[i].join();
+		const double Time = MillisecondsSince(Start);
+		BENCHMARK_CHECK(LoadedGraphs == static_cast<int>(ThreadCount) * GraphsPerThread);
+
+		const double Throughput = LoadedGraphs * 1000.0 / Time;
+		if (ThreadCount == 1)
+			SingleThreadThroughput = Throughput;
+		std::printf("  %zu threads: %.1f graphs per second, %.2fx speedup\n", ThreadCount, Throughput, Throughput / SingleThreadThroughput);
+	}
+}
+
+// Graph of 100k elements is loaded from JSON and cleared twice, second load reuses pools of the same area.
+static void BenchmarkLoadAndClear()
+{
+	std::printf("Load and clear\n");
+	const size_t ChainCount = 100;
+	const size_t ChainLength = 100;
+	const size_t ReroutesPerConnection = 5;
+
+	NodeArea* SourceArea = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> Heads;
+	BuildChains(SourceArea, ChainCount, ChainLength, false, Heads);
+	size_t ConnectionCount = 0;
+	for (size_t i = 0; i < Heads.size(); i++)
+	{
+		const std::vector<SumNode*> Chain = GetChain(Heads[i]);
+		for (size_t j = 1; j < Chain.size(); j++)
+		{
+			for (size_t k = 0; k < ReroutesPerConnection; k++)
+				SourceArea->AddRerouteNodeToConnection(Chain[j - 1], 0, Chain[j], 0, k, ImVec2(static_cast<float>(k) * 10.0f, static_cast<float>(j) * 10.0f));
+
+			ConnectionCount++;
+		}
+	}
+
+	const size_t NodeCount = ChainCount * ChainLength;
+	// Node with its three sockets, connection with its reroute nodes.
+	const size_t ElementCount = NodeCount * 4 + ConnectionCount * (1 + ReroutesPerConnection);
+	const std::string Json = SourceArea->ToJson();
+	NODE_SYSTEM.DeleteNodeArea(SourceArea);
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	for (int Run = 0; Run < 2; Run++)
+	{
+		size_t Allocations = AllocationCount;
+		BenchmarkClock::time_point Start = BenchmarkClock::now();
+		Area->LoadFromJson(Json);
+		const double LoadTime = MillisecondsSince(Start);
+		const size_t LoadAllocations = AllocationCount - Allocations;
+		BENCHMARK_CHECK(Area->GetNodeCount() == NodeCount);
+		// Connections are loaded in order of their keys, so saved text could differ only in order of connections.
+		BENCHMARK_CHECK(Area->ToJson().size() == Json.size());
+		size_t LoadedConnectionCount = 0;
+		const std::vector<Node*> LoadedNodes = Area->GetNodesByType("SumNode");
+		for (size_t i = 0; i < LoadedNodes.size(); i++)
+			LoadedConnectionCount += static_cast<SumNode*>(LoadedNodes[i])->GetInput(0)->GetConnectedSockets().size();
+		BENCHMARK_CHECK(LoadedConnectionCount == ConnectionCount);
+
+		Allocations = AllocationCount;
+		Start = BenchmarkClock::now();
+		Area->Clear();
+		const double ClearTime = MillisecondsSince(Start);
+		const size_t ClearAllocations = AllocationCount - Allocations;
+		BENCHMARK_CHECK(Area->GetNodeCount() == 0);
+
+		std::printf("  %s load of %zu elements: %.3f ms, %zu allocations, clear %.3f ms, %zu allocations\n",
+		            Run == 0 ? "first" : "second", ElementCount, LoadTime, LoadAllocations, ClearTime, ClearAllocations);
+	}
+
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Deleting 20k connected nodes at once against deleting them one by one, one more chain stays in area.
+static void BenchmarkDeleteNodes()
+{
+	std::printf("Deleting nodes\n");
+	const size_t ChainCount = 200;
+	const size_t ChainLength = 100;
+
+	for (int Batched = 1; Batched >= 0; Batched--)
+	{
+		NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+		std::vector<SumNode*> Heads;
+		const std::vector<SumNode*> Tails = BuildChains(Area, ChainCount + 1, ChainLength, false, Heads);
+
+		std::vector<Node*> NodesToDelete;
+		for (size_t i = 0; i < ChainCount; i++)
+		{
+			const std::vector<SumNode*> Chain = GetChain(Heads[i]);
+			NodesToDelete.insert(NodesToDelete.end(), Chain.begin(), Chain.end());
+		}
+
+		const BenchmarkClock::time_point Start = BenchmarkClock::now();
+		if (Batched == 1)
+		{
+			Area->DeleteNodes(NodesToDelete);
+		}
+		else
+		{
+			for (size_t i = 0; i < NodesToDelete.size(); i++)
+				Area->DeleteNode(NodesToDelete[i]);
+		}
+		const double Time = MillisecondsSince(Start);
+
+		BENCHMARK_CHECK(Area->GetNodeCount() == ChainLength);
+		BENCHMARK_CHECK(GetChain(Heads[ChainCount]).size() == ChainLength && GetChain(Heads[ChainCount]).back() == Tails[ChainCount]);
+
+		std::printf("  %s: %zu nodes in %.3f ms\n", Batched == 1 ? "DeleteNodes" : "DeleteNode one by one", NodesToDelete.size(), Time);
+		NODE_SYSTEM.DeleteNodeArea(Area);
+	}
+}
+
+// Several threads trigger socket events while thread that calls Update delivers them.
+static void BenchmarkSocketEventProducers()
+{
+	std::printf("Socket events from several threads\n");
+	const int ProducerCount = 8;
+	const int EventsPerProducer = 20000;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	Area->SetMaxSocketEventDeliveries(0);
+	std::vector<int> Log;
+	CounterNode* Source = new CounterNode(-1, &Log);
+	Area->AddNode(Source);
+	std::vector<CounterNode*> Receivers;
+	for (int i = 0; i < ProducerCount; i++)
+	{
+		Receivers.push_back(new CounterNode(i, &Log));
+		Area->AddNode(Receivers.back());
+		BENCHMARK_CHECK(Area->TryToConnect(Source, 0, Receivers.back(), 0));
+	}
+
+	std::atomic<int> FinishedProducers(0);
+	const BenchmarkClock::time_point Start = BenchmarkClock::now();
+	std::vector<std::thread> Producers;
+	for (int i = 0; i < ProducerCount; i++)
+	{
+		Producers.push_back(std::thread([&, i]() {
+			for (int j = 0; j < EventsPerProducer; j++)
+				Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[i]->GetInput(0), EXECUTE);
+			FinishedProducers++;
+		}));
+	}
+
+	while (FinishedProducers.load() < ProducerCount)
+		Area->Update();
+	for (size_t i = 0; i < Producers.size(); i++)
+		Producers[i].join();
+	Area->Update();
+	const double Time = MillisecondsSince(Start);
+
+	for (int i = 0; i < ProducerCount; i++)
+		BENCHMARK_CHECK(CountInLog(Log, i) == static_cast<size_t>(EventsPerProducer));
+
+	std::printf("  %d threads: %.1f ns per event, trigger and delivery\n", ProducerCount, Time * 1e6 / (ProducerCount * EventsPerProducer));
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Callbacks with filter get only events of their node and type, removed callback gets nothing.
+static void CheckFilteredNodeEvents()
+{
+	std::printf("Filtered node event callbacks\n");
+	const size_t NodeCount = 1000;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<int> Log;
+	std::vector<CounterNode*> Nodes;
+	std::vector<size_t> Calls(NodeCount, 0);
+	std::vector<SlotHandle> Handles;
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		Nodes.push_back(new CounterNode(static_cast<int>(i), &Log));
+		Area->AddNode(Nodes.back());
+
+		NodeEventFilter Filter;
+		Filter.EventMask = 1u << AFTER_CONNECTED;
+		Filter.TargetNode = Nodes.back();
+		Handles.push_back(Area->AddNodeEventCallback([&Calls, i](Node*, NODE_EVENT) { Calls[i]++; }, Filter));
+	}
+
+	size_t AllCalls = 0;
+	Area->AddNodeEventCallback([&AllCalls](Node*, NODE_EVENT) { AllCalls++; });
+
+	const BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (size_t i = 1; i < NodeCount; i++)
+		Area->TryToConnect(Nodes[i - 1], 0, Nodes[i], 0);
+	const double Time = MillisecondsSince(Start);
+
+	// Every connection sends AFTER_CONNECTED to both of its nodes.
+	BENCHMARK_CHECK(Calls[0] == 1 && Calls[NodeCount - 1] == 1);
+	for (size_t i = 1; i + 1 < NodeCount; i++)
+		BENCHMARK_CHECK(Calls[i] == 2);
+	BENCHMARK_CHECK(AllCalls > 2 * (NodeCount - 1));
+
+	BENCHMARK_CHECK(Area->RemoveNodeEventCallback(Handles[0]));
+	BENCHMARK_CHECK(!Area->RemoveNodeEventCallback(Handles[0]));
+	Area->TryToDisconnect(Nodes[0], 0, Nodes[1], 0);
+	Area->TryToConnect(Nodes[0], 0, Nodes[1], 0);
+	BENCHMARK_CHECK(Calls[0] == 1 && Calls[1] == 3);
+
+	std::printf("  %zu connections with %zu filtered callbacks: %.3f ms\n", NodeCount - 1, NodeCount, Time);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Listeners that care about one node each, subscribed with filter against callbacks that filter internally.
+// Connect and disconnect cost is measured without listeners and subtracted.
+static void BenchmarkNodeEventDispatch()
+{
+	std::printf("Node event dispatch\n");
+	const size_t ListenerCount = 50;
+	const size_t Cycles = 12500;
+	// Connect and disconnect send BEFORE and AFTER event to both nodes.
+	const size_t EventCount = Cycles * 8;
+
+	double Times[3] = { 0.0, 0.0, 0.0 };
+	std::vector<size_t> Calls[3];
+	size_t DeliveredEvents = 0;
+	size_t TimedEvents = 0;
+	for (int Mode = 0; Mode < 3; Mode++)
+	{
+		NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+		std::vector<int> Log;
+		std::vector<CounterNode*> Nodes;
+		Calls[Mode].assign(ListenerCount, 0);
+		std::vector<size_t>& ModeCalls = Calls[Mode];
+		for (size_t i = 0; i < ListenerCount; i++)
+		{
+			Nodes.push_back(new CounterNode(static_cast<int>(i), &Log));
+			Area->AddNode(Nodes.back());
+
+			const Node* Target = Nodes.back();
+			if (Mode == 1)
+			{
+				NodeEventFilter Filter;
+				Filter.EventMask = 1u << AFTER_CONNECTED;
+				Filter.TargetNode = Target;
+				Area->AddNodeEventCallback([&ModeCalls, i](Node*, NODE_EVENT) { ModeCalls[i]++; }, Filter);
+			}
+			else if (Mode == 2)
+			{
+				Area->AddNodeEventCallback([&ModeCalls, &DeliveredEvents, i, Target](Node* Node, const NODE_EVENT Event) {
+					if (i == 0)
+						DeliveredEvents++;
+					if (Node == Target && Event == AFTER_CONNECTED)
+						ModeCalls[i]++;
+				});
+			}
+		}
+
+		const BenchmarkClock::time_point Start = BenchmarkClock::now();
+		for (size_t i = 0; i < Cycles; i++)
+		{
+			Node* Out = Nodes[i % ListenerCount];
+			Node* In = Nodes[(i + 1) % ListenerCount];
+			Area->TryToConnect(Out, 0, In, 0);
+			Area->TryToDisconnect(Out, 0, In, 0);
+		}
+		Times[Mode] = MillisecondsSince(Start);
+		TimedEvents = DeliveredEvents;
+
+		NODE_SYSTEM.DeleteNodeArea(Area);
+	}
+
+	size_t TotalCalls = 0;
+	for (size_t i = 0; i < ListenerCount; i++)
+		TotalCalls += Calls[1][i];
+	BENCHMARK_CHECK(TotalCalls == Cycles * 2);
+	BENCHMARK_CHECK(Calls[1] == Calls[2]);
+	BENCHMARK_CHECK(TimedEvents == EventCount);
+
+	const double FilteredTime = std::max(Times[1] - Times[0], 0.0);
+	const double UnfilteredTime = std::max(Times[2] - Times[0], 0.0);
+	std::printf("  %zu listeners, %zu events: filtered subscriptions %.3f ms, filtering in callbacks %.3f ms (connecting itself %.3f ms)\n",
+	            ListenerCount, EventCount, FilteredTime, UnfilteredTime, Times[0]);
+}
+
+// Chains of pure nodes without inputs are folded by Compile, so Execute has nothing left to do.
+static void BenchmarkPlanOptimization()
+{
+	std::printf("NodeExecutionPlan optimization\n");
+	const size_t ChainCount = 10;
+	const size_t ChainLength = 100;
+	const int Runs = 200;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<SumNode*> Heads;
+	const std::vector<SumNode*> Tails = BuildChains(Area, ChainCount, ChainLength, true, Heads);
+	for (size_t i = 0; i < Heads.size(); i++)
+	{
+		const std::vector<SumNode*> Chain = GetChain(Heads[i]);
+		for (size_t j = 0; j < Chain.size(); j++)
+			Chain[j]->SetIsPure(true);
+	}
+	// Chain with node that is not pure is executed every time.
+	Heads[0]->SetIsPure(false);
+
+	NodeExecutionPlan Plan(Area);
+	double Times[2] = { 0.0, 0.0 };
+	for (int Optimize = 0; Optimize < 2; Optimize++)
+	{
+		// Values of folded nodes come from Compile, so they should follow new bias.
+		for (size_t i = 0; i < Heads.size(); i++)
+			Heads[i]->SetBias(static_cast<double>(i + 1 + Optimize));
+
+		Plan.SetOptimizing(Optimize == 1);
+		BENCHMARK_CHECK(Plan.Compile());
+
+		const BenchmarkClock::time_point Start = BenchmarkClock::now();
+		for (int Run = 0; Run < Runs; Run++)
+			Plan.Execute();
+		Times[Optimize] = MillisecondsSince(Start) / Runs;
+
+		for (size_t i = 0; i < Tails.size(); i++)
+			BENCHMARK_CHECK(*Tails[i]->GetOutput(0)->GetValue<double>() == static_cast<double>((i + 1) * ChainLength + Optimize));
+	}
+
+	// Sinks of plan without targets are observed, so nothing is eliminated.
+	const NodeExecutionPlanReport& Report = Plan.GetOptimizationReport();
+	BENCHMARK_CHECK(Report.FoldedNodeIDs.size() == (ChainCount - 1) * ChainLength);
+	BENCHMARK_CHECK(Report.EliminatedNodeIDs.empty());
+
+	std::printf("  %zu of %zu nodes folded: %.3f ms, without optimization %.3f ms\n", Report.FoldedNodeIDs.size(), ChainCount * ChainLength, Times[1], Times[0]);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+static void GetNodesAABB(const std::vector<CounterNode*>& Nodes, const ImVec2 Offset, ImVec2& Min, ImVec2& Max)
+{
+	Min = ImVec2(FLT_MAX, FLT_MAX);
+	Max = ImVec2(-FLT_MAX, -FLT_MAX);
+	for (size_t i = 0; i < Nodes.size(); i++)
+	{
+		const ImVec2 Position = Nodes[i]->GetPosition();
+		const ImVec2 Size = Nodes[i]->GetSize();
+		Min.x = std::min(Min.x, Position.x + Offset.x);
+		Min.y = std::min(Min.y, Position.y + Offset.y);
+		Max.x = std::max(Max.x, Position.x + Offset.x + Size.x);
+		Max.y = std::max(Max.y, Position.y + Offset.y + Size.y);
+	}
+}
+
+// Bounds from geometry block of area against walking Node pointers, geometry block follows moved and deleted nodes.
+static void BenchmarkNodeGeometry()
+{
+	std::printf("Node geometry\n");
+	const size_t NodeCount = 100000;
+	const int Runs = 100;
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<int> Log;
+	std::vector<CounterNode*> Nodes;
+	uint32_t Random = 12345;
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		Nodes.push_back(new CounterNode(static_cast<int>(i), &Log));
+		Random = Random * 1664525u + 1013904223u;
+		Nodes.back()->SetPosition(ImVec2(static_cast<float>(Random % 100000), static_cast<float>((Random >> 8) % 100000)));
+		Area->AddNode(Nodes.back());
+	}
+
+	ImVec2 Min, Max, ExpectedMin, ExpectedMax;
+	const BenchmarkClock::time_point Start = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+		Area->GetAllElementsAABB(Min, Max);
+	const double Time = MillisecondsSince(Start) / Runs;
+
+	// Nodes of long edited graph are scattered in memory, so pointers are visited in shuffled order.
+	std::vector<CounterNode*> ShuffledNodes = Nodes;
+	for (size_t i = ShuffledNodes.size() - 1; i > 0; i--)
+	{
+		Random = Random * 1664525u + 1013904223u;
+		std::swap(ShuffledNodes[i], ShuffledNodes[Random % (i + 1)]);
+	}
+
+	BenchmarkClock::time_point PointerStart = BenchmarkClock::now();
+	for (int Run = 0; Run < Runs; Run++)
+		GetNodesAABB(ShuffledNodes, Area->GetRenderOffset(), ExpectedMin, ExpectedMax);
+	const double PointerTime = MillisecondsSince(PointerStart) / Runs;
+	BENCHMARK_CHECK(Min.x == ExpectedMin.x && Min.y == ExpectedMin.y && Max.x == ExpectedMax.x && Max.y == ExpectedMax.y);
+
+	// Moved node extends bounds, then every other node is deleted.
+	Nodes[7]->SetPosition(ImVec2(-5000.0f, 250000.0f));
+	Area->GetAllElementsAABB(Min, Max);
+	BENCHMARK_CHECK(Min.x == -5000.0f + Area->GetRenderOffset().x && Max.y == 250000.0f + Area->GetRenderOffset().y + Nodes[7]->GetSize().y);
+
+	std::vector<Node*> ToDelete;
+	std::vector<CounterNode*> Remaining;
+	for (size_t i = 0; i < Nodes.size(); i++)
+	{
+		if (i % 2 == 1)
+			ToDelete.push_back(Nodes[i]);
+		else
+			Remaining.push_back(Nodes[i]);
+	}
+	Area->DeleteNodes(ToDelete);
+
+	Area->GetAllElementsAABB(Min, Max);
+	GetNodesAABB(Remaining, Area->GetRenderOffset(), ExpectedMin, ExpectedMax);
+	BENCHMARK_CHECK(Area->GetNodeCount() == Remaining.size());
+	BENCHMARK_CHECK(Min.x == ExpectedMin.x && Min.y == ExpectedMin.y && Max.x == ExpectedMax.x && Max.y == ExpectedMax.y);
+
+	std::printf("  bounds of %zu nodes: geometry block %.3f ms, through Node pointers %.3f ms, %.1fx faster\n", NodeCount, Time, PointerTime, PointerTime / Time);
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+// Node deleted during delivery loses its queued events, other events keep their order and Update.
+static void CheckEventsOfDeletedNodes()
+{
+	std::printf("Socket events of deleted nodes\n");
+
+	NodeArea* Area = NODE_SYSTEM.CreateNodeArea();
+	std::vector<int> Log;
+	CounterNode* Source = new CounterNode(0, &Log);
+	Area->AddNode(Source);
+	std::vector<CounterNode*> Receivers;
+	for (int i = 1; i <= 3; i++)
+	{
+		Receivers.push_back(new CounterNode(i, &Log));
+		Area->AddNode(Receivers.back());
+		BENCHMARK_CHECK(Area->TryToConnect(Source, 0, Receivers.back(), 0));
+	}
+
+	Receivers[0]->SetNodeToDelete(Receivers[1]);
+	for (int Round = 0; Round < 2; Round++)
+	{
+		for (size_t i = 0; i < Receivers.size(); i++)
+			Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[i]->GetInput(0), EXECUTE);
+	}
+	Area->Update();
+
+	BENCHMARK_CHECK(Log == std::vector<int>({ 1, 3, 1, 3 }));
+	BENCHMARK_CHECK(Area->GetNodeCount() == 3);
+	BENCHMARK_CHECK(Area->GetDeferredSocketEventCount() == 0);
+
+	// Node deleted between Updates.
+	Log.clear();
+	Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[2]->GetInput(0), EXECUTE);
+	Area->TriggerSocketEvent(Source->GetOutput(0), Receivers[0]->GetInput(0), EXECUTE);
+	Area->DeleteNode(Receivers[2]);
+	Area->Update();
+	BENCHMARK_CHECK(Log == std::vector<int>({ 1 }));
+
+	NODE_SYSTEM.DeleteNodeArea(Area);
+}
+
+int main()
+{
+	NODE_SYSTEM.Initialize(true);
+	NODE_FACTORY.RegisterNodeType("SumNode", []() -> Node* { return new SumNode(0.0, false); }, [](const Node&) -> Node* { return new SumNode(0.0, false); });
+
+	BenchmarkExecutionPlan();
+	BenchmarkBatchExecution();
+	BenchmarkPlanTargets();
+	BenchmarkPlanOptimization();
+	BenchmarkEvaluator();
+	BenchmarkEvaluatorScaling();
+	BenchmarkContextScaling();
+	BenchmarkNodeGeometry();
+	BenchmarkBoxSelection();
+	BenchmarkLoadAndClear();
+	BenchmarkDeleteNodes();
+	CheckFilteredNodeEvents();
+	BenchmarkNodeEventDispatch();
+	CheckTransactions();
+	CheckScheduler();
+	CheckEventsOfDeletedNodes();
+	BenchmarkSocketEventProducers();
+	CheckEventStormLimit();
+
+	if (FailedChecks > 0)
+		std::printf("%d checks failed\n", FailedChecks);
+
+	return FailedChecks == 0 ? 0 : 1;
+}
\ No newline at end of file
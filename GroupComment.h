@@ -1,6 +1,6 @@
 #pragma once
 
-#include "VisualNodeFactory.h"
+#include "VisualNodeContext.h"
 
 namespace VisNodeSys
 {
@@ -1,16 +1,16 @@
 #include "VisualNodeArea.h"
 using namespace VisNodeSys;
 
-ImVec2 NodeArea::NeededShift = ImVec2();
-
-NodeArea::NodeArea()
+NodeArea::NodeArea(NodeContext* Context)
 {
+	this->Context = Context != nullptr ? Context : &NodeContext::GetDefault();
 	SetSize(ImVec2(256, 256));
 };
 
 NodeArea::~NodeArea() 
 {
 	Clear();
+	RemoveAllNodeEventCallbacks();
 }
 
 ImVec2 NodeArea::GetSize() const
@@ -41,22 +41,29 @@ void NodeArea::SetPosition(const ImVec2 NewValue)
 
 void NodeArea::Update()
 {
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	if (!NODE_CORE.bIsInTestMode)
 		InputUpdate();
+#endif
 
-	for (int i = 0; i < static_cast<int>(Nodes.size()); i++)
+	std::vector<Node*> NodesToDestroy;
+	for (size_t i = 0; i < Nodes.size(); i++)
 	{
 		if (Nodes[i]->bShouldBeDestroyed)
-		{
-			DeleteNode(Nodes[i]);
-			i--;
-			break;
-		}
+			NodesToDestroy.push_back(Nodes[i]);
 	}
 
+	if (!NodesToDestroy.empty())
+		DeleteNodes(NodesToDestroy);
+
+	// Finished asynchronous work queues EXECUTE events, so they are processed in this frame.
+	ProcessAsyncCompletions();
 	ProcessSocketEventQueue();
+	DestroyNodesWaitingForSocketEvents();
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	if (!NODE_CORE.bIsInTestMode)
 		Render();
+#endif
 }
 
 void NodeArea::SetMainContextMenuFunc(void(*Func)())
@@ -66,7 +73,9 @@ void NodeArea::SetMainContextMenuFunc(void(*Func)())
 
 void NodeArea::Clear()
 {
+	DiscardTransaction();
 	bClearing = true;
+	UnSelectAll();
 
 	for (int i = 0; i < static_cast<int>(GroupComments.size()); i++)
 	{
@@ -74,7 +83,6 @@ void NodeArea::Clear()
 		i--;
 	}
 	GroupComments.clear();
-	SelectedGroupComments.clear();
 
 	for (int i = 0; i < static_cast<int>(Nodes.size()); i++)
 	{
@@ -84,11 +92,33 @@ void NodeArea::Clear()
 		i--;
 	}
 	Nodes.clear();
-	SelectedNodes.clear();
-	SelectedRerouteNodes.clear();
+	NodeGeometry.Clear();
+	ResetTopologicalOrder();
+	DirtyNodes.clear();
+	ScheduledSocketEvents.clear();
+	DeferredSocketEvents.clear();
+	CarriedOverSocketEvents.clear();
+	SocketEventBatch.clear();
+	SocketEventsInBatch.clear();
+
+	// Every queued event belonged to removed nodes.
+	SocketEvent Event;
+	while (SocketEventQueue.TryPop(Event))
+		continue;
+	for (size_t i = 0; i < NodesWaitingForSocketEvents.size(); i++)
+		delete NodesWaitingForSocketEvents[i];
+	NodesWaitingForSocketEvents.clear();
+
+	// Connections were removed together with nodes, release pool memory in bulk.
+	Connections.clear();
+	AllRerouteNodes.clear();
+	ConnectionPool.Clear();
+	RerouteNodePool.Clear();
 	
 	RenderOffset = ImVec2(0, 0);
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	NodeAreaWindow = nullptr;
+#endif
 	
 	SocketLookingForConnection = nullptr;
 	SocketHovered = nullptr;
@@ -104,21 +134,167 @@ void NodeArea::Reset()
 	Clear();
 
 	MainContextMenuFunc = nullptr;
-	NodeEventsCallbacks.clear();
+	RemoveAllNodeEventCallbacks();
 }
 
-void NodeArea::AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func)
+SlotHandle NodeArea::AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func)
 {
-	if (Func != nullptr)
-		NodeEventsCallbacks.push_back(Func);
+	return AddNodeEventCallback(Func, NodeEventFilter());
 }
 
-void NodeArea::PropagateNodeEventsCallbacks(Node* Node, const NODE_EVENT EventToPropagate) const
+SlotHandle NodeArea::AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func, const NodeEventFilter& Filter)
 {
-	for (size_t i = 0; i < NodeEventsCallbacks.size(); i++)
+	if (Func == nullptr)
+		return SlotHandle();
+
+	NodeEventSubscription* NewSubscription = new NodeEventSubscription();
+	NewSubscription->Func = Func;
+	NewSubscription->Filter = Filter;
+
+	for (size_t i = 0; i < NODE_EVENT_COUNT; i++)
 	{
-		if (NodeEventsCallbacks[i] != nullptr)
-			NodeEventsCallbacks[i](Node, EventToPropagate);
+		if (Filter.EventMask & (1u << i))
+			GetNodeEventListenerList(i, NewSubscription)->push_back(NewSubscription);
+	}
+
+	NewSubscription->Handle = NodeEventSubscriptions.Insert(NewSubscription);
+	return NewSubscription->Handle;
+}
+
+std::vector<NodeArea::NodeEventSubscription*>* NodeArea::GetNodeEventListenerList(const size_t EventIndex, const NodeEventSubscription* Subscription)
+{
+	NodeEventListeners& Listeners = NodeEventListenersByEvent[EventIndex];
+
+	// Specific node is more narrow filter than node type, so it takes precedence.
+	if (Subscription->Filter.TargetNode != nullptr)
+		return &Listeners.ByNode[Subscription->Filter.TargetNode];
+
+	if (!Subscription->Filter.NodeType.empty())
+		return &Listeners.ByNodeType[Subscription->Filter.NodeType];
+
+	return &Listeners.AnyNode;
+}
+
+bool NodeArea::RemoveNodeEventCallback(const SlotHandle Handle)
+{
+	NodeEventSubscription* Subscription = NodeEventSubscriptions.Get(Handle);
+	if (Subscription == nullptr || Subscription->bRemoved)
+		return false;
+
+	Subscription->bRemoved = true;
+	if (NodeEventDispatchDepth > 0)
+	{
+		PendingNodeEventCallbackRemovals.push_back(Handle);
+		return true;
+	}
+
+	UnlinkNodeEventCallback(Handle);
+	return true;
+}
+
+void NodeArea::UnlinkNodeEventCallback(const SlotHandle Handle)
+{
+	NodeEventSubscription* Subscription = NodeEventSubscriptions.Get(Handle);
+	if (Subscription == nullptr)
+		return;
+
+	for (size_t i = 0; i < NODE_EVENT_COUNT; i++)
+	{
+		if (!(Subscription->Filter.EventMask & (1u << i)))
+			continue;
+
+		std::vector<NodeEventSubscription*>* List = GetNodeEventListenerList(i, Subscription);
+		List->erase(std::remove(List->begin(), List->end(), Subscription), List->end());
+
+		NodeEventListeners& Listeners = NodeEventListenersByEvent[i];
+		if (List->empty() && Subscription->Filter.TargetNode != nullptr)
+			Listeners.ByNode.erase(Subscription->Filter.TargetNode);
+		else if (List->empty() && !Subscription->Filter.NodeType.empty())
+			Listeners.ByNodeType.erase(Subscription->Filter.NodeType);
+	}
+
+	NodeEventSubscriptions.Remove(Handle);
+	delete Subscription;
+}
+
+void NodeArea::RemoveNodeEventCallbacksOf(const Node* Node)
+{
+	std::vector<SlotHandle> HandlesToRemove;
+	for (size_t i = 0; i < NODE_EVENT_COUNT; i++)
+	{
+		if (NodeEventListenersByEvent[i].ByNode.empty())
+			continue;
+
+		const auto Iterator = NodeEventListenersByEvent[i].ByNode.find(Node);
+		if (Iterator == NodeEventListenersByEvent[i].ByNode.end())
+			continue;
+
+		for (size_t j = 0; j < Iterator->second.size(); j++)
+			HandlesToRemove.push_back(Iterator->second[j]->Handle);
+	}
+
+	// Subscription to several events is listed several times, repeated removal is ignored.
+	for (size_t i = 0; i < HandlesToRemove.size(); i++)
+		RemoveNodeEventCallback(HandlesToRemove[i]);
+}
+
+void NodeArea::RemoveAllNodeEventCallbacks()
+{
+	for (size_t i = 0; i < NodeEventSubscriptions.size(); i++)
+		delete NodeEventSubscriptions[i];
+	NodeEventSubscriptions.clear();
+
+	for (size_t i = 0; i < NODE_EVENT_COUNT; i++)
+		NodeEventListenersByEvent[i] = NodeEventListeners();
+
+	PendingNodeEventCallbackRemovals.clear();
+}
+
+void NodeArea::PropagateNodeEventsCallbacks(Node* Node, const NODE_EVENT EventToPropagate)
+{
+	// Transaction reports its changes with one change set on commit.
+	if (bTransactionActive)
+		return;
+
+	NodeEventListeners& Listeners = NodeEventListenersByEvent[EventToPropagate];
+	std::vector<NodeEventSubscription*>* Lists[3] = { &Listeners.AnyNode, nullptr, nullptr };
+
+	if (!Listeners.ByNodeType.empty())
+	{
+		auto Iterator = Listeners.ByNodeType.find(Node->Type);
+		if (Iterator != Listeners.ByNodeType.end())
+			Lists[1] = &Iterator->second;
+	}
+
+	if (!Listeners.ByNode.empty())
+	{
+		auto Iterator = Listeners.ByNode.find(Node);
+		if (Iterator != Listeners.ByNode.end())
+			Lists[2] = &Iterator->second;
+	}
+
+	NodeEventDispatchDepth++;
+	for (size_t i = 0; i < 3; i++)
+	{
+		if (Lists[i] == nullptr)
+			continue;
+
+		// Size is checked on every step, callbacks could add new listeners.
+		for (size_t j = 0; j < Lists[i]->size(); j++)
+		{
+			NodeEventSubscription* Subscription = (*Lists[i])[j];
+			if (!Subscription->bRemoved)
+				Subscription->Func(Node, EventToPropagate);
+		}
+	}
+	NodeEventDispatchDepth--;
+
+	if (NodeEventDispatchDepth == 0 && !PendingNodeEventCallbackRemovals.empty())
+	{
+		std::vector<SlotHandle> HandlesToUnlink;
+		HandlesToUnlink.swap(PendingNodeEventCallbackRemovals);
+		for (size_t i = 0; i < HandlesToUnlink.size(); i++)
+			UnlinkNodeEventCallback(HandlesToUnlink[i]);
 	}
 }
 
@@ -145,12 +321,12 @@ void NodeArea::SaveNodesToFile(const char* FileName, std::vector<Node*> Nodes)
 	delete NewNodeArea;
 }
 
-bool NodeArea::IsAlreadyConnected(NodeSocket* FirstSocket, NodeSocket* SecondSocket, const std::vector<Connection*>& Connections)
+bool NodeArea::IsAlreadyConnected(NodeSocket* FirstSocket, NodeSocket* SecondSocket)
 {
-	for (size_t i = 0; i < Connections.size(); i++)
+	for (size_t i = 0; i < FirstSocket->Connections.size(); i++)
 	{
 		// if node is connected to node that is not in this list just ignore.
-		if (Connections[i]->In == FirstSocket && Connections[i]->Out == SecondSocket)
+		if (FirstSocket->Connections[i]->In == FirstSocket && FirstSocket->Connections[i]->Out == SecondSocket)
 			return true;
 	}
 
@@ -168,10 +344,11 @@ void NodeArea::ProcessConnections(const std::vector<NodeSocket*>& Sockets,
 		NodeSocket* CurrentSocket = Sockets[i];
 		for (const auto& ConnectedSocket : CurrentSocket->ConnectedSockets)
 		{
-			if (Node::IsNodeWithIDInList(ConnectedSocket->GetParent()->GetID(), SourceNodes))
+			// Only connections between copied nodes are recreated, their sockets are already in the map.
+			if (OldToNewSocket.find(ConnectedSocket) != OldToNewSocket.end())
 			{
 				// Check maybe we already establish this connection.
-				if (!IsAlreadyConnected(OldToNewSocket[CurrentSocket], OldToNewSocket[ConnectedSocket], TargetArea->Connections))
+				if (!IsAlreadyConnected(OldToNewSocket[CurrentSocket], OldToNewSocket[ConnectedSocket]))
 				{
 					std::unordered_map<RerouteNode*, RerouteNode*> OldToNewRerouteNode;
 					// Get connection info from old node area.
@@ -185,9 +362,8 @@ void NodeArea::ProcessConnections(const std::vector<NodeSocket*>& Sockets,
 					for (size_t j = 0; j < OldConnection->RerouteNodes.size(); j++)
 					{
 						RerouteNode* OldReroute = OldConnection->RerouteNodes[j];
-						RerouteNode* NewReroute = new RerouteNode();
-						NewReroute->ID = NODE_CORE.GetUniqueHexID();
-						NewReroute->Parent = NewConnection;
+						RerouteNode* NewReroute = TargetArea->CreateRerouteNode(NewConnection);
+						NewReroute->ID = TargetArea->Context->GetUniqueHexID();
 						NewReroute->Position = OldReroute->Position;
 
 						if (OldReroute->BeginSocket != nullptr)
@@ -224,7 +400,7 @@ void NodeArea::CopyNodesInternal(const std::vector<Node*>& SourceNodes, NodeArea
 	std::unordered_map<NodeSocket*, NodeSocket*> OldToNewSocket;
 	for (size_t i = 0; i < SourceNodes.size(); i++)
 	{
-		Node* CopyOfNode = NODE_FACTORY.CopyNode(SourceNodes[i]->GetType(), *SourceNodes[i]);
+		Node* CopyOfNode = TargetArea->Context->GetFactory().CopyNode(SourceNodes[i]->GetType(), *SourceNodes[i]);
 
 		if (CopyOfNode == nullptr)
 			CopyOfNode = new Node(*SourceNodes[i]);
@@ -255,7 +431,11 @@ void NodeArea::CopyNodesInternal(const std::vector<Node*>& SourceNodes, NodeArea
 
 NodeArea* NodeArea::CreateNodeArea(const std::vector<Node*> Nodes, const std::vector<GroupComment*> GroupComments)
 {
-	NodeArea* NewArea = new NodeArea();
+	NodeContext* Context = nullptr;
+	if (!Nodes.empty() && Nodes[0]->GetParentArea() != nullptr)
+		Context = Nodes[0]->GetParentArea()->GetContext();
+
+	NodeArea* NewArea = new NodeArea(Context);
 	CopyNodesInternal(Nodes, NewArea);
 
 	for (size_t i = 0; i < GroupComments.size(); i++)
@@ -350,7 +530,7 @@ std::string NodeArea::ToJson() const
 void NodeArea::CopyNodesTo(NodeArea* SourceNodeArea, NodeArea* TargetNodeArea)
 {
 	const size_t NodeShift = TargetNodeArea->Nodes.size();
-	CopyNodesInternal(SourceNodeArea->Nodes, TargetNodeArea, NodeShift);
+	CopyNodesInternal(SourceNodeArea->Nodes.GetElements(), TargetNodeArea, NodeShift);
 
 	for (size_t i = 0; i < SourceNodeArea->GroupComments.size(); i++)
 	{
@@ -380,7 +560,7 @@ void NodeArea::LoadFromJson(std::string JsonText)
 	for (size_t i = 0; i < NodesList.size(); i++)
 	{
 		std::string NodeType = root["nodes"][std::to_string(i)]["nodeType"].asCString();
-		Node* NewNode = NODE_FACTORY.CreateNode(NodeType);
+		Node* NewNode = Context->GetFactory().CreateNode(NodeType);
 		if (NewNode == nullptr)
 		{
 			if (NodeType == "VisualNode")
@@ -421,10 +601,9 @@ void NodeArea::LoadFromJson(std::string JsonText)
 		std::vector<Json::String> RerouteList = root["connections"][ConnectionsList[i]]["reroute_connections"].getMemberNames();
 		for (size_t j = 0; j < RerouteList.size(); j++)
 		{
-			RerouteNode* NewReroute = new RerouteNode();
+			RerouteNode* NewReroute = CreateRerouteNode(NewConnection);
 			std::string ID = root["connections"][ConnectionsList[i]]["reroute_connections"][std::to_string(j)]["reroute_ID"].asCString();
 			NewReroute->ID = ID;
-			NewReroute->Parent = NewConnection;
 
 			NewReroute->Position.x = root["connections"][ConnectionsList[i]]["reroute_connections"][std::to_string(j)]["position_x"].asFloat();
 			NewReroute->Position.y = root["connections"][ConnectionsList[i]]["reroute_connections"][std::to_string(j)]["position_y"].asFloat();
@@ -551,17 +730,6 @@ size_t NodeArea::GetNodeCount() const
 	return Nodes.size();
 }
 
-bool NodeArea::IsEmptyOrFilledByNulls(const std::vector<Node*> Vector)
-{
-	for (size_t i = 0; i < Vector.size(); i++)
-	{
-		if (Vector[i] != nullptr)
-			return false;
-	}
-
-	return true;
-}
-
 ConnectionStyle* NodeArea::GetConnectionStyle(const NodeSocket* ParticipantOfConnection) const
 {
 	if (ParticipantOfConnection == nullptr)
@@ -641,8 +809,10 @@ std::vector<ConnectionSegment> NodeArea::GetConnectionSegments(const Connection*
 ImVec2 NodeArea::LocalToScreen(ImVec2 LocalPosition) const
 {
 	ImVec2 WindowPosition = ImVec2(0.0f, 0.0f);
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	if (ImGui::GetCurrentContext() != nullptr && ImGui::GetCurrentContext()->CurrentWindow != nullptr)
 		WindowPosition = ImGui::GetCurrentWindow()->Pos;
+#endif
 
 	return WindowPosition + LocalPosition * Zoom + RenderOffset;
 }
@@ -650,8 +820,10 @@ ImVec2 NodeArea::LocalToScreen(ImVec2 LocalPosition) const
 ImVec2 NodeArea::ScreenToLocal(ImVec2 ScreenPosition) const
 {
 	ImVec2 WindowPosition = ImVec2(0.0f, 0.0f);
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	if (ImGui::GetCurrentContext() != nullptr && ImGui::GetCurrentContext()->CurrentWindow != nullptr)
 		WindowPosition = ImGui::GetCurrentWindow()->Pos;
+#endif
 
 	return (ScreenPosition - WindowPosition - RenderOffset) / Zoom;
 }
@@ -700,4 +872,298 @@ bool NodeArea::IsSecondRectInsideFirstOne(ImVec2 FirstRectMin, ImVec2 FirstRectS
 	}
 
 	return false;
+}
+
+ImVec2 NodeArea::SocketToPosition(const NodeSocket* Socket) const
+{
+	const bool Input = !Socket->bOutput;
+	float SocketX = 0.0f;
+	float SocketY = 0.0f;
+
+	int SocketIndex = -1;
+	if (Input)
+	{
+		for (size_t i = 0; i < Socket->Parent->Input.size(); i++)
+		{
+			if (Socket->Parent->Input[i] == Socket)
+			{
+				SocketIndex = static_cast<int>(i);
+				break;
+			}
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < Socket->Parent->Output.size(); i++)
+		{
+			if (Socket->Parent->Output[i] == Socket)
+			{
+				SocketIndex = static_cast<int>(i);
+				break;
+			}
+		}
+	}
+
+	if (Socket->GetParent()->GetStyle() == DEFAULT)
+	{
+		SocketX = Input ? Socket->Parent->LeftTop.x + GetNodeSocketSize() * 3 : Socket->Parent->RightBottom.x - GetNodeSocketSize() * 3;
+
+		const float HeightForSockets = Socket->Parent->GetSize().y * Zoom - GetNodeTitleHeight();
+		const float SocketSpacing = HeightForSockets / (Input ? Socket->Parent->Input.size() : Socket->Parent->Output.size());
+
+		SocketY = (Socket->Parent->LeftTop.y + GetNodeTitleHeight() + SocketSpacing * (SocketIndex + 1) - SocketSpacing / 2.0f);
+	}
+	else if (Socket->GetParent()->GetStyle() == CIRCLE)
+	{
+		const size_t SocketCount = Input ? Socket->Parent->Input.size() : Socket->Parent->Output.size();
+		float BeginAngle = (180.0f / static_cast<float>(SocketCount) / 2.0f);
+		if (Input)
+			BeginAngle = -BeginAngle;
+
+		float step = (180.0f / static_cast<float>(SocketCount) * (SocketIndex));
+		if (Input)
+			step = -step;
+
+		const float angle = BeginAngle + step;
+
+		const float NodeCenterX = Socket->Parent->LeftTop.x + NODE_DIAMETER * Zoom / 2.0f;
+		const float NodeCenterY = Socket->Parent->LeftTop.y + NODE_DIAMETER * Zoom / 2.0f;
+
+		SocketX = NodeCenterX + NODE_DIAMETER * Zoom * 0.95f * sin(glm::radians(angle));
+		SocketY = NodeCenterY + NODE_DIAMETER * Zoom * 0.95f * cos(glm::radians(angle));
+	}
+
+	return {SocketX, SocketY};
+}
+
+NodeContext* NodeArea::GetContext() const
+{
+	return Context;
+}
+
+ImVec2 NodeArea::GetRenderOffset() const
+{
+	return RenderOffset;
+}
+
+void NodeArea::SetRenderOffset(const ImVec2 Offset)
+{
+	if (Offset.x <= -Settings.Style.Grid.GRID_SIZE || Offset.x >= Settings.Style.Grid.GRID_SIZE ||
+		Offset.y <= -Settings.Style.Grid.GRID_SIZE || Offset.y >= Settings.Style.Grid.GRID_SIZE)
+		return;
+
+	RenderOffset = Offset;
+}
+
+void NodeArea::GetAllElementsAABB(ImVec2& Min, ImVec2& Max) const
+{
+	Min.x = FLT_MAX;
+	Min.y = FLT_MAX;
+
+	Max.x = -FLT_MAX;
+	Max.y = -FLT_MAX;
+
+	for (size_t i = 0; i < NodeGeometry.Size(); i++)
+	{
+		if (NodeGeometry.X[i] + RenderOffset.x < Min.x)
+			Min.x = NodeGeometry.X[i] + RenderOffset.x;
+
+		if (NodeGeometry.X[i] + RenderOffset.x + NodeGeometry.W[i] > Max.x)
+			Max.x = NodeGeometry.X[i] + RenderOffset.x + NodeGeometry.W[i];
+
+		if (NodeGeometry.Y[i] + RenderOffset.y < Min.y)
+			Min.y = NodeGeometry.Y[i] + RenderOffset.y;
+
+		if (NodeGeometry.Y[i] + RenderOffset.y + NodeGeometry.H[i] > Max.y)
+			Max.y = NodeGeometry.Y[i] + RenderOffset.y + NodeGeometry.H[i];
+	}
+
+	for (size_t i = 0; i < GroupComments.size(); i++)
+	{
+		if (GroupComments[i]->GetPosition().x + RenderOffset.x < Min.x)
+			Min.x = GroupComments[i]->GetPosition().x + RenderOffset.x;
+
+		if (GroupComments[i]->GetPosition().x + RenderOffset.x + GroupComments[i]->GetSize().x > Max.x)
+			Max.x = GroupComments[i]->GetPosition().x + RenderOffset.x + GroupComments[i]->GetSize().x;
+
+		if (GroupComments[i]->GetPosition().y + RenderOffset.y < Min.y)
+			Min.y = GroupComments[i]->GetPosition().y + RenderOffset.y;
+
+		if (GroupComments[i]->GetPosition().y + RenderOffset.y + GroupComments[i]->GetSize().y > Max.y)
+			Max.y = GroupComments[i]->GetPosition().y + RenderOffset.y + GroupComments[i]->GetSize().y;
+	}
+}
+
+ImVec2 NodeArea::GetAllElementsAABBCenter() const
+{
+	ImVec2 min, max;
+	GetAllElementsAABB(min, max);
+
+	return {min.x + (max.x - min.x) / 2.0f, min.y + (max.y - min.y) / 2.0f};
+}
+
+bool NodeArea::IsFillingWindow()
+{
+	return bFillWindow;
+}
+
+void NodeArea::SetIsFillingWindow(bool NewValue)
+{
+	bFillWindow = NewValue;
+}
+
+float NodeArea::GetZoomFactor() const
+{
+	return Zoom;
+}
+
+void NodeArea::SetZoomFactor(float NewValue)
+{
+	if (NewValue < MIN_ZOOM_LEVEL || NewValue > MAX_ZOOM_LEVEL)
+		return;
+
+	Zoom = NewValue;
+}
+
+bool NodeArea::GetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle& Style) const
+{
+	if (Node == nullptr || SocketIndex < 0)
+		return false;
+
+	if (bOutputSocket)
+	{
+		if (SocketIndex >= Node->Output.size())
+			return false;
+
+		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Output[SocketIndex]);
+		if (TempVariable != nullptr)
+		{
+			Style = *TempVariable;
+			return true;
+		}
+
+		return false;
+	}
+	else
+	{
+		if (SocketIndex >= Node->Input.size())
+			return false;
+
+		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Input[SocketIndex]);
+		if (TempVariable != nullptr)
+		{
+			Style = *TempVariable;
+			return true;
+		}
+
+		return false;
+	}
+}
+
+void NodeArea::SetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle NewStyle)
+{
+	if (Node == nullptr || SocketIndex < 0)
+		return;
+
+	if (bOutputSocket)
+	{
+		if (SocketIndex >= Node->Output.size())
+			return;
+
+		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Output[SocketIndex]);
+		if (TempVariable != nullptr)
+			*TempVariable = NewStyle;
+	}
+	else
+	{
+		if (SocketIndex >= Node->Input.size())
+			return;
+
+		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Input[SocketIndex]);
+		if (TempVariable != nullptr)
+			*TempVariable = NewStyle;
+	}
+}
+
+void NodeGeometryBlock::Add(const Node* Node)
+{
+	X.push_back(0.0f);
+	Y.push_back(0.0f);
+	W.push_back(0.0f);
+	H.push_back(0.0f);
+	Style.push_back(0);
+	Flags.push_back(0);
+
+	Set(X.size() - 1, Node);
+}
+
+void NodeGeometryBlock::Set(const size_t Index, const Node* Node)
+{
+	X[Index] = Node->GetPosition().x;
+	Y[Index] = Node->GetPosition().y;
+	W[Index] = Node->GetSize().x;
+	H[Index] = Node->GetSize().y;
+	Style[Index] = static_cast<uint8_t>(Node->GetStyle());
+
+	// Selection is owned by NodeArea, it is not derived from Node.
+	uint8_t NewFlags = Flags[Index] & NODE_GEOMETRY_SELECTED;
+	if (Node->CouldBeMoved())
+		NewFlags |= NODE_GEOMETRY_COULD_BE_MOVED;
+	if (Node->IsHovered())
+		NewFlags |= NODE_GEOMETRY_HOVERED;
+	Flags[Index] = NewFlags;
+}
+
+void NodeGeometryBlock::SwapRemove(const size_t Index)
+{
+	const size_t Last = X.size() - 1;
+	X[Index] = X[Last];
+	Y[Index] = Y[Last];
+	W[Index] = W[Last];
+	H[Index] = H[Last];
+	Style[Index] = Style[Last];
+	Flags[Index] = Flags[Last];
+
+	X.pop_back();
+	Y.pop_back();
+	W.pop_back();
+	H.pop_back();
+	Style.pop_back();
+	Flags.pop_back();
+}
+
+void NodeGeometryBlock::Reserve(const size_t Count)
+{
+	X.reserve(Count);
+	Y.reserve(Count);
+	W.reserve(Count);
+	H.reserve(Count);
+	Style.reserve(Count);
+	Flags.reserve(Count);
+}
+
+void NodeGeometryBlock::Clear()
+{
+	X.clear();
+	Y.clear();
+	W.clear();
+	H.clear();
+	Style.clear();
+	Flags.clear();
+}
+
+ImVec2 NodeGeometryBlock::GetExtent(const size_t Index) const
+{
+	if (Style[Index] == CIRCLE)
+		return ImVec2(NODE_DIAMETER, NODE_DIAMETER);
+
+	return ImVec2(W[Index], H[Index]);
+}
+
+void NodeArea::UpdateNodeGeometry(const Node* Node)
+{
+	if (Node == nullptr || Nodes.Get(Node->AreaHandle) != Node)
+		return;
+
+	NodeGeometry.Set(Nodes.GetElementIndex(Node->AreaHandle), Node);
 }
\ No newline at end of file
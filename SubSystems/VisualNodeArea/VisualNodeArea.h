@@ -1,6 +1,9 @@
 #pragma once
 
 #include "../../GroupComment.h"
+#include "../../VisualNodeObjectPool.h"
+#include "../../VisualNodeMPSCQueue.h"
+#include "../VisualNodeEvaluation/VisualNodeThreadPool.h"
 
 namespace VisNodeSys
 {
@@ -19,6 +22,86 @@ namespace VisNodeSys
 		AFTER_DISCONNECTED = 5
 	};
 
+#define NODE_EVENT_COUNT 6
+#define ALL_NODE_EVENTS ((1u << NODE_EVENT_COUNT) - 1)
+
+	enum NODE_TRAVERSAL_DIRECTION
+	{
+		// Follow connections from outputs to inputs.
+		TRAVERSE_DOWNSTREAM = 0,
+		// Follow connections from inputs to outputs.
+		TRAVERSE_UPSTREAM = 1,
+		TRAVERSE_BOTH = 2
+	};
+
+	enum NODE_TRAVERSAL_ORDER
+	{
+		BREADTH_FIRST = 0,
+		DEPTH_FIRST = 1
+	};
+
+	// Empty NodeType and nullptr TargetNode match any node.
+	struct NodeEventFilter
+	{
+		// Bit mask of (1u << NODE_EVENT) values.
+		uint32_t EventMask = ALL_NODE_EVENTS;
+		std::string NodeType;
+		const Node* TargetNode = nullptr;
+	};
+
+	// Everything that happened during one transaction, in order of changes.
+	// Removed nodes are still valid during change set callbacks and are destroyed right after them.
+	struct NodeAreaChangeSet
+	{
+		std::vector<Node*> AddedNodes;
+		std::vector<Node*> RemovedNodes;
+		// Pairs of output and input sockets.
+		std::vector<std::pair<NodeSocket*, NodeSocket*>> AddedConnections;
+		std::vector<std::pair<NodeSocket*, NodeSocket*>> RemovedConnections;
+
+		bool IsEmpty() const { return AddedNodes.empty() && RemovedNodes.empty() && AddedConnections.empty() && RemovedConnections.empty(); }
+	};
+
+	// Counters of dirty tracking, accumulated until ResetDirtyStatistics.
+	struct NodeAreaDirtyStatistics
+	{
+		size_t MarkedNodes = 0;
+		size_t Recomputations = 0;
+		// Times dirty marking reached node that was already dirty.
+		// Each of them would be one more recomputation if every connection propagated update separately.
+		size_t RecomputationsSaved = 0;
+		size_t Flushes = 0;
+	};
+
+	// Counters of socket event scheduler, accumulated until ResetSocketEventStatistics.
+	struct NodeAreaSocketEventStatistics
+	{
+		// Events that wait for later Update.
+		size_t QueueDepth = 0;
+		size_t MaxQueueDepth = 0;
+		size_t DeliveredEvents = 0;
+		// Updates that ran out of time budget before all events were delivered.
+		size_t BudgetExceededUpdates = 0;
+		// Time from Update that first saw event to its delivery, in milliseconds.
+		double TotalWaitTime = 0.0;
+		double MaxWaitTime = 0.0;
+
+		double GetAverageWaitTime() const { return DeliveredEvents == 0 ? 0.0 : TotalWaitTime / static_cast<double>(DeliveredEvents); }
+	};
+
+	// Socket that reached its limit of socket event deliveries in one flush.
+	struct NodeAreaEventStormReport
+	{
+		std::string NodeID;
+		std::string SocketID;
+		size_t Deliveries = 0;
+		// IDs of nodes in order in which events went through them, ending with node of socket.
+		// Found by following last caller of each socket, so it shows one path even when there are several.
+		std::vector<std::string> Path;
+		// True if path starts with node that is also later in it, so events sustain themselves.
+		bool bCycle = false;
+	};
+
 	struct NodeAreaGeneralConnectionStyle
 	{
 		int LineSegments = 16;
@@ -49,6 +132,7 @@ namespace VisNodeSys
 		ImVec4 NodeBackgroundColor = ImVec4(75.0f / 255.0f, 75.0f / 255.0f, 75.0f / 255.0f, 125.0f / 255.0f);
 		ImVec4 HoveredNodeBackgroundColor = ImVec4(60.0f / 255.0f, 60.0f / 255.0f, 60.0f / 255.0f, 125.0f / 255.0f);
 		ImVec4 NodeSelectionColor = ImVec4(175.0f / 255.0f, 255.0f / 255.0f, 175.0f / 255.0f, 1.0f);
+		ImVec4 NodeBusyIndicatorColor = ImVec4(1.0f, 200.0f / 255.0f, 60.0f / 255.0f, 1.0f);
 
 		ImVec4 MouseSelectRegionColor = ImVec4(175.0f / 255.0f, 175.0f / 255.0f, 1.0f, 125.0f / 255.0f);
 
@@ -62,13 +146,70 @@ namespace VisNodeSys
 		bool bRequireFullOverlapToSelect = false;
 		bool bShowDefaultMainContextMenu = true;
 		bool bReduceTransparencyForUnconnectableSockets = true;
+		bool bRejectCycles = false;
+		bool bCoalesceSocketEvents = false;
+		bool bScheduleSocketEvents = false;
+		// In milliseconds, 0 means that every pending event is delivered in one Update.
+		float SocketEventTimeBudget = 0.0f;
+		// Events over this limit for one socket wait for next Update, 0 means no limit.
+		size_t MaxSocketEventDeliveriesPerFlush = 1024;
+	};
+
+	enum NODE_GEOMETRY_FLAG
+	{
+		NODE_GEOMETRY_COULD_BE_MOVED = 1 << 0,
+		NODE_GEOMETRY_HOVERED = 1 << 1,
+		NODE_GEOMETRY_SELECTED = 1 << 2
+	};
+
+	// Hot node data in structure-of-arrays layout, element i always describes NodeArea::Nodes[i].
+	// Geometric passes (hit testing, rubber-band selection, AABB) iterate it without touching Node objects.
+	struct NodeGeometryBlock
+	{
+		std::vector<float> X;
+		std::vector<float> Y;
+		std::vector<float> W;
+		std::vector<float> H;
+		std::vector<uint8_t> Style;
+		std::vector<uint8_t> Flags;
+
+		void Add(const Node* Node);
+		void Set(size_t Index, const Node* Node);
+		void SwapRemove(size_t Index);
+		void Reserve(size_t Count);
+		void Clear();
+		size_t Size() const { return X.size(); }
+
+		// Size that is used for hit testing, circle nodes ignore Node::Size.
+		ImVec2 GetExtent(size_t Index) const;
 	};
 
+	// Connection for NodeArea::ConnectNodes, node indices refer to vector of nodes passed with it.
+	struct NodeAreaBatchConnection
+	{
+		size_t OutNodeIndex = 0;
+		size_t OutSocketIndex = 0;
+		size_t InNodeIndex = 0;
+		size_t InSocketIndex = 0;
+	};
+
+	struct NodeAreaBatchConnectionByID
+	{
+		std::string OutNodeID;
+		std::string OutSocketID;
+		std::string InNodeID;
+		std::string InSocketID;
+	};
+
+	class NodeEvaluator;
+
 	class NodeArea
 	{
 		friend NodeSystem;
+		friend Node;
+		friend NodeEvaluator;
 	public:
-		NodeArea();
+		NodeArea(NodeContext* Context = nullptr);
 		~NodeArea();
 
 		static NodeArea* CreateNodeArea(std::vector<Node*> Nodes, const std::vector<GroupComment*> GroupComments);
@@ -80,6 +221,8 @@ namespace VisNodeSys
 		void LoadFromFile(const char* FileName);
 		void SaveNodesToFile(const char* FileName, std::vector<Node*> Nodes);
 
+		NodeContext* GetContext() const;
+
 		ImVec2 GetPosition() const;
 		void SetPosition(ImVec2 NewValue);
 
@@ -95,6 +238,8 @@ namespace VisNodeSys
 		Node* GetHovered() const;
 		std::vector<Node*> GetSelected();
 		void UnSelectAll();
+		// Region is in area coordinates, nodes in it replace previous node selection.
+		void SelectNodesInRegion(ImVec2 RegionMin, ImVec2 RegionMax);
 
 		bool IsMouseHovered() const;
 		bool IsFillingWindow();
@@ -111,14 +256,59 @@ namespace VisNodeSys
 
 		void AddNode(Node* NewNode);
 		void DeleteNode(const Node* Node);
+		// Deletes nodes and all their connections in one pass.
+		// Remaining nodes get BEFORE_DISCONNECTED and AFTER_DISCONNECTED once, deleted nodes get only REMOVED.
+		void DeleteNodes(const std::vector<Node*>& NodesToDelete);
 		size_t GetNodeCount() const;
-		void AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func);
+		// Returned handle could be used to remove callback, it is null if Func is empty.
+		SlotHandle AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func);
+		SlotHandle AddNodeEventCallback(std::function<void(Node*, NODE_EVENT)> Func, const NodeEventFilter& Filter);
+		bool RemoveNodeEventCallback(SlotHandle Handle);
+		void AddChangeSetCallback(std::function<void(const NodeAreaChangeSet&)> Func);
 		void RunOnEachNode(void(*Func)(Node*));
 		void RunOnEachConnectedNode(Node* StartNode, void(*Func)(Node*));
+
+		// Visits every node reachable from StartNode exactly once, StartNode included.
+		// Func is called as bool(Node*), returning false stops traversal. Graph should not be modified during traversal.
+		// Returns false if traversal was stopped by Func.
+		template<typename Callable>
+		bool TraverseNodes(Node* StartNode, Callable&& Func, NODE_TRAVERSAL_DIRECTION Direction = TRAVERSE_DOWNSTREAM, NODE_TRAVERSAL_ORDER Order = BREADTH_FIRST)
+		{
+			typedef typename std::remove_reference<Callable>::type CallableType;
+			return TraverseNodesInternal(StartNode, Direction, Order, [](void* Context, Node* CurrentNode) -> bool {
+				return (*static_cast<CallableType*>(Context))(CurrentNode);
+			}, const_cast<void*>(static_cast<const void*>(&Func)));
+		}
+		// Sends UPDATE only to nodes connected to outputs of CallerNode, MarkDirty covers whole downstream.
 		void PropagateUpdateToConnectedNodes(const Node* CallerNode) const;
 
+		// Could be called from any thread, event is delivered by next Update.
+		// Without explicit priority event gets priority of node that owns TriggeredNodeSocket.
 		bool TriggerSocketEvent(NodeSocket* CallerNodeSocket, NodeSocket* TriggeredNodeSocket, NODE_SOCKET_EVENT EventType);
+		bool TriggerSocketEvent(NodeSocket* CallerNodeSocket, NodeSocket* TriggeredNodeSocket, NODE_SOCKET_EVENT EventType, int Priority);
 		bool TriggerOrphanSocketEvent(Node* Node, NODE_SOCKET_EVENT EventType);
+		// With coalescing, pending events with the same triggered socket and type are delivered once,
+		// at position of the first of them and with its caller socket. Order of other events is kept.
+		bool IsCoalescingSocketEvents() const;
+		void SetCoalescingSocketEvents(bool NewValue);
+		// Number of events that were merged into earlier ones, since last reset.
+		size_t GetCoalescedSocketEventCount() const;
+		void ResetCoalescedSocketEventCount();
+		// Scheduler delivers events with higher priority first and events with equal priority in order of arrival.
+		// With time budget it stops when budget is spent, at least one event is delivered in every Update,
+		// the rest waits for next Update. Events of removed nodes are dropped.
+		bool IsSchedulingSocketEvents() const;
+		void SetSchedulingSocketEvents(bool NewValue);
+		float GetSocketEventTimeBudget() const;
+		void SetSocketEventTimeBudget(float Milliseconds);
+		NodeAreaSocketEventStatistics GetSocketEventStatistics() const;
+		void ResetSocketEventStatistics();
+		// Limit of deliveries per socket in one Update, it breaks event loops that would never end.
+		// Excess events are deferred to next Update, callback gets one report per socket and Update.
+		size_t GetMaxSocketEventDeliveries() const;
+		void SetMaxSocketEventDeliveries(size_t NewValue);
+		size_t GetDeferredSocketEventCount() const;
+		void SetEventStormCallback(std::function<void(const NodeAreaEventStormReport&)> Callback);
 
 		// *********************** Group Comments ************************
 		GroupComment* GetGroupCommentByID(std::string GroupCommentID) const;
@@ -136,7 +326,9 @@ namespace VisNodeSys
 
 		void GetAllElementsAABB(ImVec2& Min, ImVec2& Max) const;
 		ImVec2 GetAllElementsAABBCenter() const;
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		ImVec2 GetRenderedViewCenter() const;
+#endif
 
 		// *********************** Connections ************************
 		bool TryToConnect(const Node* OutNode, size_t OutNodeSocketIndex, const Node* InNode, size_t InNodeSocketIndex);
@@ -155,12 +347,116 @@ namespace VisNodeSys
 
 		bool GetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle& Style) const;
 		void SetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle NewStyle);
+
+		// *********************** Batch construction ************************
+		// Between BeginBatch and EndBatch connecting does not fire any events.
+		// EndBatch delivers them at once: BEFORE_CONNECTED and AFTER_CONNECTED once per node, CONNECTED once per connection.
+		// Batches could be nested, events are delivered by outermost EndBatch.
+		void BeginBatch(size_t ExpectedNodeCount = 0, size_t ExpectedConnectionCount = 0);
+		void EndBatch();
+		bool IsInBatch() const;
+
+		void AddNodes(const std::vector<Node*>& NewNodes);
+		// Returns number of created connections, invalid descriptions are skipped.
+		size_t ConnectNodes(const std::vector<Node*>& NodesToConnect, const std::vector<NodeAreaBatchConnection>& ConnectionsToCreate);
+		size_t ConnectNodes(const std::vector<NodeAreaBatchConnectionByID>& ConnectionsToCreate);
+
+		// *********************** Transactions ************************
+		// Inside transaction node event callbacks are not called and socket events are postponed.
+		// Commit delivers postponed socket events and one NodeAreaChangeSet to change set callbacks.
+		// Abort reverts added and removed nodes and connections without any events.
+		// Pending socket events and asynchronous tasks of removed nodes are dropped only by commit, so abort restores them.
+		// Transactions could not be nested, BeginTransaction returns false if one is already active.
+		bool BeginTransaction();
+		bool CommitTransaction();
+		bool AbortTransaction();
+		bool IsInTransaction() const;
+
+		// *********************** Topological order ************************
+		// Order is kept up to date on every new connection, only nodes between two connected ones could be reordered.
+		// Returns empty vector if graph contains cycles.
+		std::vector<Node*> GetTopologicalOrder();
+		bool HasCycles();
+		// When enabled TryToConnect refuses connections that would create a cycle.
+		bool IsRejectingCycles() const;
+		void SetRejectingCycles(bool NewValue);
+		// Changes every time node or connection is added or removed.
+		uint64_t GetTopologyVersion() const;
+
+		// *********************** Dirty tracking ************************
+		// MarkDirty marks node and every node downstream of it, nodes that are already dirty are not visited again.
+		// FlushDirtyNodes recomputes each dirty node once, in topological order, with SocketEvent(nullptr, nullptr, UPDATE).
+		// Nodes marked during flush are recomputed by next flush. Returns number of recomputed nodes.
+		void MarkDirty(Node* Node);
+		bool IsDirty(const Node* Node) const;
+		size_t GetDirtyNodeCount() const;
+		size_t FlushDirtyNodes();
+		NodeAreaDirtyStatistics GetDirtyStatistics() const;
+		void ResetDirtyStatistics();
+
+		// *********************** Asynchronous execution ************************
+		// Work runs on executor, Completion runs on thread that calls Update, during first Update after Work finished.
+		// After Completion EXECUTE is sent to every node connected to outputs of node.
+		// Node could be removed while Work runs, so Work should use only data captured by value and check bCancelled.
+		// Removing node cancels its tasks, their Completion is never called.
+		bool RunAsync(Node* Node, std::function<void(const std::atomic<bool>& bCancelled)> Work, std::function<void()> Completion = nullptr);
+		void CancelAsync(Node* Node);
+		bool IsBusy(const Node* Node) const;
+		size_t GetPendingAsyncTaskCount() const;
+		// Blocks until every task is finished and delivers them. Returns number of delivered tasks.
+		size_t WaitForAsyncTasks();
+		// Executor is not owned by area and should be set before first task.
+		// Without it area creates its own pool with one worker.
+		ThreadPool* GetAsyncExecutor();
+		void SetAsyncExecutor(ThreadPool* NewValue);
 	private:
+		enum TRANSACTION_RECORD_TYPE
+		{
+			TRANSACTION_NODE_ADDED,
+			TRANSACTION_NODE_REMOVED,
+			TRANSACTION_CONNECTION_ADDED,
+			TRANSACTION_CONNECTION_REMOVED,
+			TRANSACTION_REROUTE_REMOVED
+		};
+
+		struct TransactionRecord
+		{
+			TRANSACTION_RECORD_TYPE Type;
+			Node* TargetNode = nullptr;
+			NodeSocket* OutSocket = nullptr;
+			NodeSocket* InSocket = nullptr;
+			// Reroute nodes of removed connection, or single removed reroute node, to restore them on abort.
+			std::vector<std::string> RerouteNodeIDs;
+			std::vector<ImVec2> RerouteNodePositions;
+			size_t RerouteNodeIndex = 0;
+			// DetachNode clears dirty flag of removed node.
+			bool bWasDirty = false;
+		};
+
+		bool bTransactionActive = false;
+		std::vector<TransactionRecord> TransactionLog;
+		std::vector<std::function<void(const NodeAreaChangeSet&)>> ChangeSetCallbacks;
+		void RecordTransaction(TRANSACTION_RECORD_TYPE Type, Node* Node, NodeSocket* OutSocket = nullptr, NodeSocket* InSocket = nullptr);
+		void RecordConnectionRemoval(const Connection* Connection);
+		void RestoreConnection(const TransactionRecord& Record);
+		void RestoreRerouteNode(const TransactionRecord& Record);
+		void DiscardTransaction();
+		bool ContainsNode(const Node* Node) const;
+		bool IsDetachedNode(const Node* Node) const;
+
 		struct SocketEvent
 		{
 			NodeSocket* TriggeredNodeSocket;
 			NodeSocket* CallerNodeSocket;
 			NODE_SOCKET_EVENT EventType;
+			int Priority;
+		};
+
+		struct ScheduledSocketEvent
+		{
+			SocketEvent Event;
+			uint64_t Sequence;
+			std::chrono::steady_clock::time_point ArrivalTime;
 		};
 
 		NodeAreaSettings Settings;
@@ -172,24 +468,43 @@ namespace VisNodeSys
 		float GetNodeSocketSize() const { return NODE_SOCKET_SIZE * Zoom; }
 		float GetRerouteNodeSize() const { return NODE_SOCKET_SIZE * Zoom * 1.5f; }
 		float GetNodeTitleHeight() const { return NODE_TITLE_HEIGHT * Zoom; }
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		ImVec2 GetMouseDragDelta() const { return ImGui::GetMouseDragDelta(0) * Zoom; }
 		ImVec2 GetMouseDelta() const { return ImGui::GetIO().MouseDelta / Zoom; }
+#endif
 		float GetConnectionThickness() const { return 3.0f * Zoom; }
 
-		static ImVec2 NeededShift;
+		NodeContext* Context = nullptr;
+
+		// Connections and reroute nodes are allocated from per area pools.
+		ObjectPool<Connection> ConnectionPool;
+		ObjectPool<RerouteNode> RerouteNodePool;
 
 		bool bClearing = false;
+		int BatchDepth = 0;
+		std::vector<SlotHandle> BatchConnections;
 		bool bFillWindow = false;
 		bool bMouseHovered = false;
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		ImDrawList* CurrentDrawList = nullptr;
 		ImGuiWindow* NodeAreaWindow = nullptr;
-		std::vector<Node*> Nodes;
-
-		Node* HoveredNode = nullptr;
+#endif
+		SlotMap<Node> Nodes;
+		NodeGeometryBlock NodeGeometry;
+		void UpdateNodeGeometry(const Node* Node);
+		bool IsNodeNearMouse(size_t NodeIndex, ImVec2 Origin) const;
+		// Returns nullptr if node does not belong to this area.
+		uint8_t* GetNodeGeometryFlags(const Node* Node);
+		const uint8_t* GetNodeGeometryFlags(const Node* Node) const;
+		SlotMap<Connection> Connections;
+		SlotMap<RerouteNode> AllRerouteNodes;
+
+		// Hovered elements are referenced by handles, so they never dangle after delete.
+		SlotHandle HoveredNodeHandle;
 		NodeSocket* SocketLookingForConnection = nullptr;
-		Connection* HoveredConnection = nullptr;
+		SlotHandle HoveredConnectionHandle;
 		NodeSocket* SocketHovered = nullptr;
-		RerouteNode* RerouteNodeHovered = nullptr;
+		SlotHandle RerouteNodeHoveredHandle;
 		GroupComment* GroupCommentHovered = nullptr;
 
 		// Info for context menu
@@ -208,30 +523,140 @@ namespace VisNodeSys
 		ImVec2 MouseCursorSize = ImVec2(1, 1);
 		ImVec2 MouseSelectRegionMin = ImVec2(FLT_MAX, FLT_MAX);
 		ImVec2 MouseSelectRegionMax = ImVec2(FLT_MAX, FLT_MAX);
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		ImGuiWindow* MouseDownIn = nullptr;
+#endif
 		bool bOpenMainContextMenu = false;
-		std::vector<Connection*> Connections;
 
 		ImVec2 Position;
 		ImVec2 Size;
 		ImVec2 RenderOffset = ImVec2(0.0, 0.0);
 		void(*MainContextMenuFunc)() = nullptr;
 		void RenderDefaultMainContextMenu(ImVec2 LocalMousePosition);
-		std::vector<std::function<void(Node*, NODE_EVENT)>> NodeEventsCallbacks;
-		std::queue<SocketEvent> SocketEventQueue;
+		struct NodeEventSubscription
+		{
+			std::function<void(Node*, NODE_EVENT)> Func;
+			NodeEventFilter Filter;
+			SlotHandle Handle;
+			bool bRemoved = false;
+		};
 
-		void PropagateNodeEventsCallbacks(Node* Node, NODE_EVENT EventToPropagate) const;
+		// Listeners of one event type, split by filter so that dispatch touches only interested ones.
+		struct NodeEventListeners
+		{
+			std::vector<NodeEventSubscription*> AnyNode;
+			std::unordered_map<std::string, std::vector<NodeEventSubscription*>> ByNodeType;
+			std::unordered_map<const Node*, std::vector<NodeEventSubscription*>> ByNode;
+		};
+
+		SlotMap<NodeEventSubscription> NodeEventSubscriptions;
+		NodeEventListeners NodeEventListenersByEvent[NODE_EVENT_COUNT];
+		// Callbacks removed during dispatch are unlinked after it ends.
+		int NodeEventDispatchDepth = 0;
+		std::vector<SlotHandle> PendingNodeEventCallbackRemovals;
+		std::vector<NodeEventSubscription*>* GetNodeEventListenerList(size_t EventIndex, const NodeEventSubscription* Subscription);
+		void UnlinkNodeEventCallback(SlotHandle Handle);
+		void RemoveNodeEventCallbacksOf(const Node* Node);
+		void RemoveAllNodeEventCallbacks();
+		void DestroyNode(Node* Node);
+		// Destroyed nodes that queued socket events could still reference.
+		std::vector<Node*> NodesWaitingForSocketEvents;
+		void DestroyNodesWaitingForSocketEvents();
+		// Any thread could trigger socket events, only thread that calls Update processes them.
+		MPSCQueue<SocketEvent> SocketEventQueue;
+		std::vector<SocketEvent> SocketEventBatch;
+		// Bit mask of (1u << NODE_SOCKET_EVENT) values that are already in batch, per triggered socket.
+		std::unordered_map<const NodeSocket*, uint32_t> SocketEventsInBatch;
+		size_t CoalescedSocketEventCount = 0;
+		// Binary heap, ordered by ScheduledSocketEventOrder.
+		std::vector<ScheduledSocketEvent> ScheduledSocketEvents;
+		uint64_t SocketEventSequence = 0;
+		NodeAreaSocketEventStatistics SocketEventStatistics;
+		static bool ScheduledSocketEventOrder(const ScheduledSocketEvent& First, const ScheduledSocketEvent& Second);
+		void ProcessScheduledSocketEvents();
+		// Removes scheduled, deferred and carried over events that reference sockets of detached nodes.
+		// Called once after nodes are detached and before they are destroyed.
+		void RemoveSocketEventsOfDetachedNodes();
+
+		uint64_t SocketEventFlushIndex = 0;
+		std::vector<SocketEvent> DeferredSocketEvents;
+		// Events deferred by previous flush, delivered before new ones.
+		std::vector<SocketEvent> CarriedOverSocketEvents;
+		std::function<void(const NodeAreaEventStormReport&)> EventStormCallback;
+		// Returns false if event was deferred.
+		bool DeliverSocketEvent(const SocketEvent& Event);
+		void ReportEventStorm(const NodeSocket* Socket);
+
+		void PropagateNodeEventsCallbacks(Node* Node, NODE_EVENT EventToPropagate);
 		void ProcessSocketEventQueue();
+		void ProcessCoalescedSocketEvents();
 		ImVec2 SocketToPosition(const NodeSocket* Socket) const;
 		std::vector<Connection*> GetAllConnections(const NodeSocket* Socket) const;
 		Connection* GetConnection(const NodeSocket* FirstSocket, const NodeSocket* SecondSocket) const;
+		Connection* GetHoveredConnection() const;
+		RerouteNode* GetHoveredRerouteNode() const;
+
+		bool TryToConnectSockets(NodeSocket* OutSocket, NodeSocket* InSocket);
+		// Removes node from all area structures, but does not destroy it.
+		void DetachNode(Node* Node);
+
+		// Node::TopologicalIndex is position of node in TopologicalOrder, removed nodes leave holes.
+		// Dirty order is rebuilt on demand, cyclic order stays so until connection or node is removed.
+		std::vector<Node*> TopologicalOrder;
+		size_t TopologicalOrderHoles = 0;
+		uint64_t TopologyVersion = 0;
+		bool bTopologicalOrderDirty = false;
+		bool bTopologicalOrderCyclic = false;
+		std::vector<uint8_t> TopologicalVisited;
+		std::vector<Node*> TopologicalForward;
+		std::vector<Node*> TopologicalBackward;
+		std::vector<Node*> TopologicalPending;
+		std::vector<uint32_t> TopologicalPositions;
+		bool IsInTopologicalOrder(const Node* Node) const;
+		void AddToTopologicalOrder(Node* Node);
+		void RemoveFromTopologicalOrder(Node* Node);
+		void CompactTopologicalOrder();
+		void RebuildTopologicalOrder();
+		void ResetTopologicalOrder();
+		// Should be called before connection is created, returns false if connection should be refused.
+		bool UpdateTopologicalOrder(Node* OutNode, Node* InNode);
+		bool ReorderForConnection(Node* OutNode, Node* InNode);
+		void ClearTopologicalVisited(const std::vector<Node*>& VisitedNodes);
+
+		// Dirty flag is kept in Node::bDirty, list could contain handles of removed nodes.
+		std::vector<SlotHandle> DirtyNodes;
+		std::vector<Node*> DirtyPending;
+		NodeAreaDirtyStatistics DirtyStatistics;
+
+		// Task is shared with executor, which could still run it after area forgot it.
+		struct AsyncTask
+		{
+			Node* TargetNode = nullptr;
+			SlotHandle NodeHandle;
+			std::function<void(const std::atomic<bool>&)> Work;
+			std::function<void()> Completion;
+			std::atomic<bool> bCancelled{ false };
+			std::atomic<bool> bFinished{ false };
+		};
 
-		static bool IsAlreadyConnected(NodeSocket* FirstSocket, NodeSocket* SecondSocket, const std::vector<Connection*>& Connections);
+		std::vector<std::shared_ptr<AsyncTask>> AsyncTasks;
+		ThreadPool* AsyncExecutor = nullptr;
+		std::unique_ptr<ThreadPool> OwnAsyncExecutor;
+		static void RunAsyncTask(void* Context, void* Data);
+		size_t ProcessAsyncCompletions();
+		Connection* CreateConnection(NodeSocket* OutSocket, NodeSocket* InSocket);
+		void DestroyConnection(Connection* Connection);
+		RerouteNode* CreateRerouteNode(Connection* Parent);
+		void DestroyRerouteNode(RerouteNode* RerouteNode);
+
+		static bool IsAlreadyConnected(NodeSocket* FirstSocket, NodeSocket* SecondSocket);
+		static void RemoveSocketFromConnected(std::vector<NodeSocket*>& ConnectedSockets, const NodeSocket* SocketToRemove);
 		static void ProcessConnections(const std::vector<NodeSocket*>& Sockets,
 									   std::unordered_map<NodeSocket*, NodeSocket*>& OldToNewSocket,
 									   NodeArea* TargetArea, size_t NodeShift, const std::vector<Node*>& SourceNodes);
 		static void CopyNodesInternal(const std::vector<Node*>& SourceNodes, NodeArea* TargetArea, const size_t NodeShift = 0);
-		static bool IsEmptyOrFilledByNulls(const std::vector<Node*> Vector);
+		// Type erased callable, so that traversal is not instantiated for every callback type.
+		bool TraverseNodesInternal(Node* StartNode, NODE_TRAVERSAL_DIRECTION Direction, NODE_TRAVERSAL_ORDER Order, bool(*Visit)(void*, Node*), void* Context);
 
 		void Delete(Connection* Connection);
 		void Delete(RerouteNode* RerouteNode);
@@ -276,6 +701,9 @@ namespace VisNodeSys
 
 		bool AddSelected(Node* Node);
 		bool IsSelected(const Node* Node) const;
+		bool UnSelect(const Node* Node);
+		void UnSelectAllNodes();
+		void UnSelectDeletedElements(const std::vector<Node*>& DeletedNodes, const std::vector<Connection*>& DeletedConnections);
 		bool AddSelected(Connection* Connection);
 		bool IsSelected(const Connection* Connection) const;
 		bool UnSelect(const Connection* Connection);
@@ -321,6 +749,7 @@ namespace VisNodeSys
 		void Render();
 		void RenderGrid(ImVec2 CurrentPosition) const;
 		void RenderNode(Node* Node) const;
+		void RenderNodeBusyIndicator(const Node* Node) const;
 		void RenderNodeSockets(const Node* Node) const;
 		void RenderNodeSocket(NodeSocket* Socket) const;
 		std::vector<ImVec2> GetTangentsForLine(const ImVec2 P1, const ImVec2 P2) const;
@@ -0,0 +1,161 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+ThreadPool* NodeArea::GetAsyncExecutor()
+{
+	if (AsyncExecutor != nullptr)
+		return AsyncExecutor;
+
+	if (OwnAsyncExecutor == nullptr)
+		OwnAsyncExecutor.reset(new ThreadPool(1));
+
+	return OwnAsyncExecutor.get();
+}
+
+void NodeArea::SetAsyncExecutor(ThreadPool* NewValue)
+{
+	AsyncExecutor = NewValue;
+}
+
+bool NodeArea::IsBusy(const Node* Node) const
+{
+	return ContainsNode(Node) && Node->AsyncTaskCount > 0;
+}
+
+size_t NodeArea::GetPendingAsyncTaskCount() const
+{
+	return AsyncTasks.size();
+}
+
+void NodeArea::RunAsyncTask(void* /*Context*/, void* Data)
+{
+	std::shared_ptr<AsyncTask>* Task = static_cast<std::shared_ptr<AsyncTask>*>(Data);
+	// Task cancelled before it started is only marked as finished.
+	if (!(*Task)->bCancelled.load())
+		(*Task)->Work((*Task)->bCancelled);
+
+	(*Task)->bFinished.store(true);
+	delete Task;
+}
+
+bool NodeArea::RunAsync(Node* Node, std::function<void(const std::atomic<bool>& bCancelled)> Work, std::function<void()> Completion)
+{
+	if (!ContainsNode(Node) || !Work)
+		return false;
+
+	std::shared_ptr<AsyncTask> Task = std::make_shared<AsyncTask>();
+	Task->TargetNode = Node;
+	Task->NodeHandle = Node->AreaHandle;
+	Task->Work = std::move(Work);
+	Task->Completion = std::move(Completion);
+	AsyncTasks.push_back(Task);
+	Node->AsyncTaskCount++;
+
+	ThreadPoolTask PoolTask;
+	PoolTask.Run = RunAsyncTask;
+	PoolTask.Data = new std::shared_ptr<AsyncTask>(Task);
+	GetAsyncExecutor()->Submit(PoolTask);
+	return true;
+}
+
+void NodeArea::CancelAsync(Node* Node)
+{
+	if (Node == nullptr || Node->AsyncTaskCount == 0)
+		return;
+
+	size_t NewSize = 0;
+	for (size_t i = 0; i < AsyncTasks.size(); i++)
+	{
+		if (AsyncTasks[i]->TargetNode == Node)
+		{
+			AsyncTasks[i]->bCancelled.store(true);
+			continue;
+		}
+
+		AsyncTasks[NewSize++] = AsyncTasks[i];
+	}
+	AsyncTasks.resize(NewSize);
+
+	Node->AsyncTaskCount = 0;
+}
+
+size_t NodeArea::ProcessAsyncCompletions()
+{
+	// Tasks keep order in which they were started, so they are delivered in it.
+	std::vector<std::shared_ptr<AsyncTask>> FinishedTasks;
+	size_t NewSize = 0;
+	for (size_t i = 0; i < AsyncTasks.size(); i++)
+	{
+		// Node removed inside transaction could be restored by abort, so its completion waits for end of transaction.
+		const bool bWaitsForTransaction = bTransactionActive && !AsyncTasks[i]->bCancelled.load() && Nodes.Get(AsyncTasks[i]->NodeHandle) != AsyncTasks[i]->TargetNode;
+		if (AsyncTasks[i]->bFinished.load() && !bWaitsForTransaction)
+		{
+			FinishedTasks.push_back(AsyncTasks[i]);
+			continue;
+		}
+
+		AsyncTasks[NewSize++] = AsyncTasks[i];
+	}
+	AsyncTasks.resize(NewSize);
+
+	size_t DeliveredCount = 0;
+	for (size_t i = 0; i < FinishedTasks.size(); i++)
+	{
+		// Completion of previous task could have removed this node.
+		AsyncTask* Task = FinishedTasks[i].get();
+		if (Task->bCancelled.load() || Nodes.Get(Task->NodeHandle) != Task->TargetNode)
+			continue;
+
+		Task->TargetNode->AsyncTaskCount--;
+		if (Task->Completion)
+			Task->Completion();
+
+		DeliveredCount++;
+		if (Nodes.Get(Task->NodeHandle) != Task->TargetNode)
+			continue;
+
+		for (size_t j = 0; j < Task->TargetNode->Output.size(); j++)
+		{
+			NodeSocket* OutSocket = Task->TargetNode->Output[j];
+			const std::vector<NodeSocket*>& ConnectedSockets = OutSocket->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+				TriggerSocketEvent(OutSocket, ConnectedSockets[k], EXECUTE);
+		}
+	}
+
+	return DeliveredCount;
+}
+
+size_t NodeArea::WaitForAsyncTasks()
+{
+	size_t DeliveredCount = 0;
+	while (!AsyncTasks.empty())
+	{
+		bool bAllFinished = true;
+		for (size_t i = 0; i < AsyncTasks.size(); i++)
+		{
+			if (!AsyncTasks[i]->bFinished.load())
+			{
+				bAllFinished = false;
+				break;
+			}
+		}
+
+		// Completions could start new tasks, so waiting continues until none is left.
+		if (bAllFinished)
+		{
+			const size_t PendingCount = AsyncTasks.size();
+			DeliveredCount += ProcessAsyncCompletions();
+			// What is left are tasks of nodes that transaction removed, they wait for its end.
+			if (AsyncTasks.size() == PendingCount)
+				break;
+
+			continue;
+		}
+
+		if (!GetAsyncExecutor()->TryRunTask())
+			std::this_thread::yield();
+	}
+
+	return DeliveredCount;
+}
\ No newline at end of file
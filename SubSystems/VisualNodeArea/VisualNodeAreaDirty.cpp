@@ -0,0 +1,119 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+bool NodeArea::IsDirty(const Node* Node) const
+{
+	return ContainsNode(Node) && Node->bDirty;
+}
+
+size_t NodeArea::GetDirtyNodeCount() const
+{
+	size_t Result = 0;
+	for (size_t i = 0; i < DirtyNodes.size(); i++)
+	{
+		if (Nodes.Get(DirtyNodes[i]) != nullptr)
+			Result++;
+	}
+
+	return Result;
+}
+
+NodeAreaDirtyStatistics NodeArea::GetDirtyStatistics() const
+{
+	return DirtyStatistics;
+}
+
+void NodeArea::ResetDirtyStatistics()
+{
+	DirtyStatistics = NodeAreaDirtyStatistics();
+}
+
+void NodeArea::MarkDirty(Node* Node)
+{
+	if (!ContainsNode(Node))
+		return;
+
+	// Only node itself changed, cached data downstream is verified against it when requested.
+	Node->InvalidateOutputData();
+
+	if (Node->bDirty)
+	{
+		DirtyStatistics.RecomputationsSaved++;
+		return;
+	}
+
+	// Downstream of dirty node is always dirty, so traversal stops at nodes that are already marked.
+	Node->bDirty = true;
+	DirtyPending.push_back(Node);
+	while (!DirtyPending.empty())
+	{
+		VisNodeSys::Node* CurrentNode = DirtyPending.back();
+		DirtyPending.pop_back();
+		DirtyNodes.push_back(CurrentNode->AreaHandle);
+		DirtyStatistics.MarkedNodes++;
+
+		for (size_t i = 0; i < CurrentNode->Output.size(); i++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[i]->ConnectedSockets;
+			for (size_t j = 0; j < ConnectedSockets.size(); j++)
+			{
+				VisNodeSys::Node* ConnectedNode = ConnectedSockets[j]->GetParent();
+				if (!ContainsNode(ConnectedNode))
+					continue;
+
+				if (ConnectedNode->bDirty)
+				{
+					DirtyStatistics.RecomputationsSaved++;
+					continue;
+				}
+
+				ConnectedNode->bDirty = true;
+				DirtyPending.push_back(ConnectedNode);
+			}
+		}
+	}
+}
+
+size_t NodeArea::FlushDirtyNodes()
+{
+	if (DirtyNodes.empty())
+		return 0;
+
+	// Makes sure that topological indices are up to date.
+	HasCycles();
+
+	std::vector<Node*> NodesToRecompute;
+	NodesToRecompute.reserve(DirtyNodes.size());
+	for (size_t i = 0; i < DirtyNodes.size(); i++)
+	{
+		Node* DirtyNode = Nodes.Get(DirtyNodes[i]);
+		if (DirtyNode != nullptr)
+			NodesToRecompute.push_back(DirtyNode);
+	}
+	DirtyNodes.clear();
+
+	std::sort(NodesToRecompute.begin(), NodesToRecompute.end(), [](const Node* First, const Node* Second) {
+		return First->TopologicalIndex < Second->TopologicalIndex;
+	});
+
+	// Handles are used because recomputation could delete nodes.
+	std::vector<SlotHandle> Handles(NodesToRecompute.size());
+	for (size_t i = 0; i < NodesToRecompute.size(); i++)
+		Handles[i] = NodesToRecompute[i]->AreaHandle;
+
+	size_t RecomputedCount = 0;
+	for (size_t i = 0; i < Handles.size(); i++)
+	{
+		Node* DirtyNode = Nodes.Get(Handles[i]);
+		if (DirtyNode == nullptr || !DirtyNode->bDirty)
+			continue;
+
+		DirtyNode->bDirty = false;
+		DirtyNode->SocketEvent(nullptr, nullptr, UPDATE);
+		RecomputedCount++;
+	}
+
+	DirtyStatistics.Recomputations += RecomputedCount;
+	DirtyStatistics.Flushes++;
+	return RecomputedCount;
+}
\ No newline at end of file
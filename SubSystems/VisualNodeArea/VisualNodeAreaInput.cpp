@@ -115,20 +115,36 @@ void NodeArea::LeftMouseReleasedGroupCommentUpdate()
 
 void NodeArea::MouseInputUpdateNodes()
 {
-	HoveredNode = nullptr;
-	SocketHovered = nullptr;
+	// Only one node could be hovered at a time.
+	if (GetHovered() != nullptr)
+		GetHovered()->SetIsHovered(false);
 
-	for (size_t i = 0; i < Nodes.size(); i++)
-		Nodes[i]->SetIsHovered(false);
+	HoveredNodeHandle = SlotHandle();
+	SocketHovered = nullptr;
 
+	const ImVec2 Origin = LocalToScreen(ImVec2(0.0f, 0.0f));
 	for (size_t i = 0; i < Nodes.size(); i++)
 	{
+		if (!IsNodeNearMouse(i, Origin))
+			continue;
+
 		InputUpdateNode(Nodes[i]);
-		if (HoveredNode != nullptr)
+		if (GetHovered() != nullptr)
 			break;
 	}
 }
 
+bool NodeArea::IsNodeNearMouse(const size_t NodeIndex, const ImVec2 Origin) const
+{
+	// Sockets of circle nodes are placed outside of node rect.
+	const float Margin = NodeGeometry.Style[NodeIndex] == CIRCLE ? NODE_DIAMETER * Zoom : GetNodeSocketSize() * 2.0f;
+	const ImVec2 Min = Origin + ImVec2(NodeGeometry.X[NodeIndex], NodeGeometry.Y[NodeIndex]) * Zoom - ImVec2(Margin, Margin);
+	const ImVec2 Max = Min + NodeGeometry.GetExtent(NodeIndex) * Zoom + ImVec2(Margin, Margin) * 2.0f;
+
+	return MouseCursorPosition.x >= Min.x && MouseCursorPosition.x <= Max.x &&
+		   MouseCursorPosition.y >= Min.y && MouseCursorPosition.y <= Max.y;
+}
+
 void NodeArea::MouseInputUpdateGroupComments()
 {
 	GroupCommentHovered = nullptr;
@@ -138,7 +154,7 @@ void NodeArea::MouseInputUpdateGroupComments()
 		GroupComments[i]->bCaptionHovered = false;
 	}
 
-	if (HoveredNode)
+	if (GetHovered())
 		return;
 
 	// Going backwards because of the render order.
@@ -169,11 +185,11 @@ void NodeArea::LeftMouseClickNodesUpdate()
 {
 	bool bNothingElseIsSelected = SelectedNodes.size() == 0 && SelectedRerouteNodes.size() == 0 && SelectedGroupComments.size() == 0;
 	bool bCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
-	bool bHoveredCorrectly = HoveredNode != nullptr;
+	bool bHoveredCorrectly = GetHovered() != nullptr;
 
 	if (bNothingElseIsSelected && bHoveredCorrectly)
 	{
-		AddSelected(HoveredNode);
+		AddSelected(GetHovered());
 		return;
 	}
 
@@ -181,18 +197,18 @@ void NodeArea::LeftMouseClickNodesUpdate()
 	{
 		if ((bCtrlPressed && bHoveredCorrectly))
 		{
-			AddSelected(HoveredNode);
+			AddSelected(GetHovered());
 			return;
 		}
 		else if (!bCtrlPressed && bHoveredCorrectly)
 		{
 			UnSelectAll();
-			AddSelected(HoveredNode);
+			AddSelected(GetHovered());
 			return;
 		}
 		else if (!bCtrlPressed)
 		{
-			SelectedNodes.clear();
+			UnSelectAllNodes();
 			return;
 		}
 	}
@@ -200,16 +216,16 @@ void NodeArea::LeftMouseClickNodesUpdate()
 
 void NodeArea::LeftMouseClickConnectionsUpdate()
 {
-	if (HoveredConnection != nullptr)
+	if (GetHoveredConnection() != nullptr)
 	{
-		if (!IsSelected(HoveredConnection) && !ImGui::IsKeyDown(ImGuiKey_LeftCtrl) && !ImGui::IsKeyDown(ImGuiKey_RightCtrl))
+		if (!IsSelected(GetHoveredConnection()) && !ImGui::IsKeyDown(ImGuiKey_LeftCtrl) && !ImGui::IsKeyDown(ImGuiKey_RightCtrl))
 			UnSelectAllConnections();
 
 		// If it is new selection
-		if (!IsSelected(HoveredConnection))
+		if (!IsSelected(GetHoveredConnection()))
 			UnSelectAllConnections();
 
-		AddSelected(HoveredConnection);
+		AddSelected(GetHoveredConnection());
 	}
 	else
 	{
@@ -221,11 +237,11 @@ void NodeArea::LeftMouseClickRerouteUpdate()
 {
 	bool bNothingElseIsSelected = SelectedNodes.size() == 0 && SelectedRerouteNodes.size() == 0 && SelectedGroupComments.size() == 0;
 	bool bCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
-	bool bHoveredCorrectly = RerouteNodeHovered != nullptr;
+	bool bHoveredCorrectly = GetHoveredRerouteNode() != nullptr;
 
 	if (bNothingElseIsSelected && bHoveredCorrectly)
 	{
-		AddSelected(RerouteNodeHovered);
+		AddSelected(GetHoveredRerouteNode());
 		return;
 	}
 
@@ -233,13 +249,13 @@ void NodeArea::LeftMouseClickRerouteUpdate()
 	{
 		if (bCtrlPressed && bHoveredCorrectly)
 		{
-			AddSelected(RerouteNodeHovered);
+			AddSelected(GetHoveredRerouteNode());
 			return;
 		}
 		else if (!bCtrlPressed && bHoveredCorrectly)
 		{
 			UnSelectAll();
-			AddSelected(RerouteNodeHovered);
+			AddSelected(GetHoveredRerouteNode());
 			return;
 		}
 		else if (!bCtrlPressed)
@@ -252,7 +268,7 @@ void NodeArea::LeftMouseClickRerouteUpdate()
 
 void NodeArea::LeftMouseClickGroupCommentsUpdate()
 {
-	if (HoveredNode == nullptr && RerouteNodeHovered == nullptr)
+	if (GetHovered() == nullptr && GetHoveredRerouteNode() == nullptr)
 	{
 		if (!IsAnyGroupCommentInResizeMode())
 		{
@@ -303,9 +319,9 @@ void NodeArea::LeftMouseClickGroupCommentsUpdate()
 
 void NodeArea::RightMouseClick()
 {
-	if (HoveredNode == nullptr)
+	if (GetHovered() == nullptr)
 	{
-		SelectedNodes.clear();
+		UnSelectAllNodes();
 		bOpenMainContextMenu = true;
 	}
 
@@ -315,7 +331,7 @@ void NodeArea::RightMouseClick()
 }
 void NodeArea::RightMouseClickNodesUpdate()
 {
-	if (HoveredNode != nullptr)
+	if (GetHovered() != nullptr)
 	{
 		// Should we disconnect sockets
 		if (SocketHovered != nullptr && !SocketHovered->ConnectedSockets.empty())
@@ -330,7 +346,7 @@ void NodeArea::RightMouseClickNodesUpdate()
 		{
 			if (SelectedNodes.size() <= 1)
 			{
-				if (!HoveredNode->OpenContextMenu())
+				if (!GetHovered()->OpenContextMenu())
 				{
 					bOpenMainContextMenu = true;
 				}
@@ -343,16 +359,16 @@ void NodeArea::RightMouseClickNodesUpdate()
 				}
 				else
 				{
-					HoveredNode->OpenContextMenu();
+					GetHovered()->OpenContextMenu();
 				}
 			}
 
 			// If hovered node was already selected do nothing
-			if (AddSelected(HoveredNode))
+			if (AddSelected(GetHovered()))
 			{
 				// But if it was not selected before deselect all other nodes.
-				SelectedNodes.clear();
-				AddSelected(HoveredNode);
+				UnSelectAllNodes();
+				AddSelected(GetHovered());
 			}
 		}
 	}
@@ -394,7 +410,7 @@ bool NodeArea::ShouldDragGrid()
 	if (!SelectedRerouteNodes.empty())
 		return false;
 
-	if (RerouteNodeHovered != nullptr)
+	if (GetHoveredRerouteNode() != nullptr)
 		return false;
 
 	if (!SelectedGroupComments.empty())
@@ -488,22 +504,7 @@ void NodeArea::MouseDraggingNodesUpdate()
 {
 	if (IsMouseRegionSelectionActive())
 	{
-		SelectedNodes.clear();
-		const ImVec2 RegionSize = MouseSelectRegionMax - MouseSelectRegionMin;
-
-		for (size_t i = 0; i < Nodes.size(); i++)
-		{
-			if (Nodes[i]->GetStyle() == DEFAULT)
-			{
-				if (IsRectInMouseSelectionRegion(Nodes[i]->LeftTop, Nodes[i]->GetSize() * Zoom))
-					AddSelected(Nodes[i]);
-			}
-			else if (Nodes[i]->GetStyle() == CIRCLE)
-			{
-				if (IsRectInMouseSelectionRegion(Nodes[i]->LeftTop, ImVec2(NODE_DIAMETER, NODE_DIAMETER) * Zoom))
-					AddSelected(Nodes[i]);
-			}
-		}
+		SelectNodesInRegion(ScreenToLocal(MouseSelectRegionMin), ScreenToLocal(MouseSelectRegionMax));
 	}
 	else
 	{
@@ -535,7 +536,6 @@ void NodeArea::MouseDraggingRerouteUpdate()
 				const ImVec2 ReroutePosition = LocalToScreen(Connections[i]->RerouteNodes[j]->Position);
 				if (IsRectInMouseSelectionRegion(ReroutePosition, ImVec2(GetRerouteNodeSize(), GetRerouteNodeSize())))
 				{
-					Connections[i]->RerouteNodes[j]->bSelected = true;
 					AddSelected(Connections[i]->RerouteNodes[j]);
 				}
 				else
@@ -562,7 +562,7 @@ void NodeArea::MouseDraggingGroupCommentUpdate()
 {
 	if (IsMouseRegionSelectionActive())
 	{
-		SelectedGroupComments.clear();
+		UnSelectAllGroupComments();
 		const ImVec2 RegionSize = MouseSelectRegionMax - MouseSelectRegionMin;
 
 		for (size_t i = 0; i < GroupComments.size(); i++)
@@ -647,28 +647,31 @@ void NodeArea::KeyboardInputUpdate()
 {
 	if (ImGui::IsKeyDown(ImGuiKey_Delete))
 	{
-		for (size_t i = 0; i < SelectedNodes.size(); i++)
-		{
-			DeleteNode(SelectedNodes[i]);
-		}
-		SelectedNodes.clear();
+		// Selection is dropped before deleting, so that each deletion does not search selection vectors.
+		const std::vector<Node*> NodesToDelete = SelectedNodes;
+		UnSelectAllNodes();
+		DeleteNodes(NodesToDelete);
 
-		for (size_t i = 0; i < SelectedConnections.size(); i++)
+		const std::vector<Connection*> ConnectionsToDelete = SelectedConnections;
+		UnSelectAllConnections();
+		for (size_t i = 0; i < ConnectionsToDelete.size(); i++)
 		{
-			Delete(SelectedConnections[i]);
-			i--;
+			Delete(ConnectionsToDelete[i]);
 		}
 
-		for (size_t i = 0; i < SelectedRerouteNodes.size(); i++)
+		// Reroute nodes of deleted connections were already removed from selection.
+		const std::vector<RerouteNode*> RerouteNodesToDelete = SelectedRerouteNodes;
+		UnSelectAllRerouteNodes();
+		for (size_t i = 0; i < RerouteNodesToDelete.size(); i++)
 		{
-			Delete(SelectedRerouteNodes[i]);
-			i--;
+			Delete(RerouteNodesToDelete[i]);
 		}
 
-		for (size_t i = 0; i < SelectedGroupComments.size(); i++)
+		const std::vector<GroupComment*> GroupCommentsToDelete = SelectedGroupComments;
+		UnSelectAllGroupComments();
+		for (size_t i = 0; i < GroupCommentsToDelete.size(); i++)
 		{
-			Delete(SelectedGroupComments[i]);
-			i--;
+			Delete(GroupCommentsToDelete[i]);
 		}
 	}
 
@@ -700,7 +703,7 @@ void NodeArea::KeyboardInputUpdate()
 				if (!reader->parse(NodesToImport.c_str(), NodesToImport.c_str() + NodesToImport.size(), &data, &err))
 					return;
 
-				NodeArea* NewNodeArea = new NodeArea();
+				NodeArea* NewNodeArea = new NodeArea(Context);
 				NewNodeArea->LoadFromJson(NodesToImport);
 
 				// ***************** Place new nodes in center of a view space *****************
@@ -708,11 +711,12 @@ void NodeArea::KeyboardInputUpdate()
 				ImVec2 NodesAABBCenter = NewNodeArea->GetAllElementsAABBCenter();
 				NodesAABBCenter -= NewNodeArea->GetRenderOffset();
 
-				NeededShift = ViewCenter - NodesAABBCenter;
+				const ImVec2 NeededShift = ViewCenter - NodesAABBCenter;
 
-				NewNodeArea->RunOnEachNode([](Node* Node) {
-					Node->SetPosition(Node->GetPosition() + NeededShift);
-				});
+				for (size_t i = 0; i < NewNodeArea->Nodes.size(); i++)
+				{
+					NewNodeArea->Nodes[i]->SetPosition(NewNodeArea->Nodes[i]->GetPosition() + NeededShift);
+				}
 
 				for (size_t i = 0; i < NewNodeArea->Connections.size(); i++)
 				{
@@ -728,7 +732,11 @@ void NodeArea::KeyboardInputUpdate()
 				}
 				// ***************** Place new nodes in center of a view space END *****************
 
+				// Paste is reported to listeners as one change set.
+				const bool bOwnTransaction = BeginTransaction();
 				NodeArea::CopyNodesTo(NewNodeArea, this);
+				if (bOwnTransaction)
+					CommitTransaction();
 
 				// Unselect all elements.
 				UnSelectAll();
@@ -736,7 +744,7 @@ void NodeArea::KeyboardInputUpdate()
 				// Select all pasted nodes.
 				for (size_t i = Nodes.size() - NewNodeArea->Nodes.size(); i < Nodes.size(); i++)
 				{
-					SelectedNodes.push_back(Nodes[i]);
+					AddSelected(Nodes[i]);
 				}
 
 				// Select all pasted reroute nodes.
@@ -763,229 +771,13 @@ void NodeArea::KeyboardInputUpdate()
 		WasCopiedToClipboard = false;
 }
 
-Node* NodeArea::GetHovered() const
-{
-	return HoveredNode;
-}
-
-std::vector<Node*> NodeArea::GetSelected()
-{
-	return SelectedNodes;
-}
-
-bool NodeArea::AddSelected(Node* Node)
-{
-	if (Node == nullptr)
-		return false;
-
-	if (IsSelected(Node))
-		return false;
-
-	SelectedNodes.push_back(Node);
-	return true;
-}
-
-bool NodeArea::IsSelected(const Node* Node) const
-{
-	if (Node == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedNodes.size(); i++)
-	{
-		if (SelectedNodes[i] == Node)
-			return true;
-	}
-
-	return false;
-}
-
-bool NodeArea::AddSelected(Connection* Connection)
-{
-	if (Connection == nullptr)
-		return false;
-
-	if (IsSelected(Connection))
-		return false;
-
-	Connection->bSelected = true;
-	SelectedConnections.push_back(Connection);
-	return true;
-}
-
-bool NodeArea::IsSelected(const Connection* Connection) const
-{
-	if (Connection == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedConnections.size(); i++)
-	{
-		if (SelectedConnections[i] == Connection)
-			return true;
-	}
-
-	return false;
-}
-
-bool NodeArea::UnSelect(const Connection* Connection)
-{
-	if (Connection == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedConnections.size(); i++)
-	{
-		if (SelectedConnections[i] == Connection)
-		{
-			SelectedConnections[i]->bSelected = false;
-			SelectedConnections.erase(SelectedConnections.begin() + i);
-			return true;
-		}
-	}
-
-	return false;
-}
-
-void NodeArea::UnSelectAllConnections()
-{
-	for (size_t i = 0; i < SelectedConnections.size(); i++)
-	{
-		SelectedConnections[i]->bSelected = false;
-	}
-
-	SelectedConnections.clear();
-}
-
-bool NodeArea::AddSelected(GroupComment* GroupComment)
-{
-	if (GroupComment == nullptr)
-		return false;
-
-	if (IsSelected(GroupComment))
-		return false;
-
-	GroupComment->bSelected = true;
-	SelectedGroupComments.push_back(GroupComment);
-	AttachElemetnsToGroupComment(GroupComment);
-
-	return true;
-}
-
-bool NodeArea::IsSelected(const GroupComment* GroupComment) const
-{
-	if (GroupComment == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedGroupComments.size(); i++)
-	{
-		if (SelectedGroupComments[i] == GroupComment)
-			return true;
-	}
-
-	return false;
-}
-
-bool NodeArea::UnSelect(GroupComment* GroupComment)
-{
-	if (GroupComment == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedGroupComments.size(); i++)
-	{
-		if (SelectedGroupComments[i] == GroupComment)
-		{
-			SelectedGroupComments[i]->bSelected = false;
-			SelectedGroupComments.erase(SelectedGroupComments.begin() + i);
-
-			GroupComment->AttachedNodes.clear();
-			GroupComment->AttachedRerouteNodes.clear();
-			GroupComment->AttachedGroupComments.clear();
-
-			return true;
-		}
-	}
-
-	return false;
-}
-
-void NodeArea::UnSelectAllGroupComments()
-{
-	for (size_t i = 0; i < SelectedGroupComments.size(); i++)
-	{
-		SelectedGroupComments[i]->bSelected = false;
-	}
-
-	SelectedGroupComments.clear();
-}
-
-bool NodeArea::AddSelected(RerouteNode* RerouteNode)
-{
-	if (RerouteNode == nullptr)
-		return false;
-
-	if (IsSelected(RerouteNode))
-		return false;
-
-	RerouteNode->bSelected = true;
-	SelectedRerouteNodes.push_back(RerouteNode);
-	return true;
-}
-
-bool NodeArea::IsSelected(const RerouteNode* RerouteNode) const
-{
-	if (RerouteNode == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedRerouteNodes.size(); i++)
-	{
-		if (SelectedRerouteNodes[i] == RerouteNode)
-			return true;
-	}
-
-	return false;
-}
-
-bool NodeArea::UnSelect(const RerouteNode* RerouteNode)
-{
-	if (RerouteNode == nullptr)
-		return false;
-
-	for (size_t i = 0; i < SelectedRerouteNodes.size(); i++)
-	{
-		if (SelectedRerouteNodes[i] == RerouteNode)
-		{
-			SelectedRerouteNodes[i]->bSelected = false;
-			SelectedRerouteNodes.erase(SelectedRerouteNodes.begin() + i);
-			return true;
-		}
-	}
-
-	return false;
-}
-
-void NodeArea::UnSelectAllRerouteNodes()
-{
-	for (size_t i = 0; i < SelectedRerouteNodes.size(); i++)
-	{
-		SelectedRerouteNodes[i]->bSelected = false;
-	}
-
-	SelectedRerouteNodes.clear();
-}
-
-void NodeArea::UnSelectAll()
-{
-	SelectedNodes.clear();
-	SelectedConnections.clear();
-	UnSelectAllRerouteNodes();
-	UnSelectAllGroupComments();
-}
-
 void NodeArea::InputUpdateNode(Node* Node)
 {
 	if (Node->GetStyle() == DEFAULT)
 	{
 		if (IsRectUnderMouse(Node->LeftTop, Node->GetSize() * Zoom))
 		{
-			HoveredNode = Node;
+			HoveredNodeHandle = Node->AreaHandle;
 			Node->SetIsHovered(true);
 		}
 	}
@@ -994,7 +786,7 @@ void NodeArea::InputUpdateNode(Node* Node)
 		if (glm::distance(glm::vec2(Node->LeftTop.x + NODE_DIAMETER / 2.0f * Zoom, Node->LeftTop.y + NODE_DIAMETER / 2.0f * Zoom),
 						  glm::vec2(MouseCursorPosition.x, MouseCursorPosition.y)) <= NODE_DIAMETER * Zoom)
 		{
-			HoveredNode = Node;
+			HoveredNodeHandle = Node->AreaHandle;
 			Node->SetIsHovered(true);
 		}
 	}
@@ -1013,11 +805,6 @@ void NodeArea::InputUpdateNode(Node* Node)
 	}
 }
 
-bool NodeArea::IsMouseHovered() const
-{
-	return bMouseHovered;
-}
-
 void NodeArea::InputUpdateSocket(NodeSocket* Socket)
 {
 	const ImVec2 SocketPosition = SocketToPosition(Socket);
@@ -1041,7 +828,7 @@ void NodeArea::InputUpdateReroute(RerouteNode* Reroute)
 		MouseCursorPosition.y >= ReroutePosition.y - GetRerouteNodeSize() &&
 		MouseCursorPosition.y <= ReroutePosition.y + GetRerouteNodeSize())
 	{
-		RerouteNodeHovered = Reroute;
+		RerouteNodeHoveredHandle = Reroute->AreaHandle;
 		Reroute->bHovered = true;
 	}
 }
@@ -1220,10 +1007,10 @@ void NodeArea::MouseInputUpdateConnections()
 {
 	for (size_t i = 0; i < Connections.size(); i++)
 		Connections[i]->bHovered = false;
-	HoveredConnection = nullptr;
+	HoveredConnectionHandle = SlotHandle();
 
-	RerouteNodeHovered = nullptr;
-	if (HoveredNode == nullptr)
+	RerouteNodeHoveredHandle = SlotHandle();
+	if (GetHovered() == nullptr)
 	{
 		for (size_t i = 0; i < Connections.size(); i++)
 		{
@@ -1232,31 +1019,30 @@ void NodeArea::MouseInputUpdateConnections()
 				Connections[i]->RerouteNodes[j]->bHovered = false;
 				InputUpdateReroute(Connections[i]->RerouteNodes[j]);
 
-				if (RerouteNodeHovered != nullptr)
+				if (GetHoveredRerouteNode() != nullptr)
 					break;
 			}
 
-			if (RerouteNodeHovered != nullptr)
+			if (GetHoveredRerouteNode() != nullptr)
 				break;
 		}
 	}
 
 	// If any node is hovered, we don't want to check for hovered connections
-	if (HoveredNode == nullptr && RerouteNodeHovered == nullptr)
+	if (GetHovered() == nullptr && GetHoveredRerouteNode() == nullptr)
 	{
 		for (size_t i = 0; i < Connections.size(); i++)
 		{
-			if (HoveredConnection == nullptr && IsMouseOverConnection(Connections[i], Settings.Style.GeneralConnection.LineSegments, 10.0f))
+			if (GetHoveredConnection() == nullptr && IsMouseOverConnection(Connections[i], Settings.Style.GeneralConnection.LineSegments, 10.0f))
 			{
 				Connections[i]->bHovered = true;
-				HoveredConnection = Connections[i];
+				HoveredConnectionHandle = Connections.GetHandle(i);
 			}
 
 			if (IsMouseRegionSelectionActive() && SelectedNodes.empty())
 			{
 				if (IsConnectionInRegion(Connections[i], Settings.Style.GeneralConnection.LineSegments))
 				{
-					Connections[i]->bSelected = true;
 					AddSelected(Connections[i]);
 				}
 				else
@@ -1269,12 +1055,7 @@ void NodeArea::MouseInputUpdateConnections()
 	}
 
 	if (!SelectedNodes.empty())
-	{
-		for (size_t i = 0; i < Connections.size(); i++)
-			Connections[i]->bSelected = false;
-
-		SelectedConnections.clear();
-	}
+		UnSelectAllConnections();
 
 	if (ImGui::IsMouseDoubleClicked(0))
 		DoubleMouseClick();
@@ -1288,20 +1069,20 @@ void NodeArea::DoubleMouseClick()
 
 void NodeArea::ConnectionsDoubleMouseClick()
 {
-	if (HoveredConnection != nullptr)
+	if (GetHoveredConnection() != nullptr)
 	{
-		if (HoveredConnection->RerouteNodes.empty())
+		if (GetHoveredConnection()->RerouteNodes.empty())
 		{
-			AddRerouteNode(HoveredConnection, 0, ScreenToLocal(MouseCursorPosition));
+			AddRerouteNode(GetHoveredConnection(), 0, ScreenToLocal(MouseCursorPosition));
 		}
 		else
 		{
-			std::vector<ConnectionSegment> Segments = GetConnectionSegments(HoveredConnection);
+			std::vector<ConnectionSegment> Segments = GetConnectionSegments(GetHoveredConnection());
 			for (size_t i = 0; i < Segments.size(); i++)
 			{
 				if (IsMouseOverSegment(Segments[i].Begin, Segments[i].End, Settings.Style.GeneralConnection.LineSegments, 10.0f))
 				{
-					AddRerouteNode(HoveredConnection, i, ScreenToLocal(MouseCursorPosition));
+					AddRerouteNode(GetHoveredConnection(), i, ScreenToLocal(MouseCursorPosition));
 					break;
 				}
 			}
@@ -1378,20 +1159,6 @@ void NodeArea::GroupCommentDoubleMouseClick()
 	}
 }
 
-bool NodeArea::IsMouseAboveSomethingSelected() const
-{
-	if (HoveredNode != nullptr && IsSelected(HoveredNode))
-		return true;
-
-	if (RerouteNodeHovered != nullptr && IsSelected(RerouteNodeHovered))
-		return true;
-
-	if (GroupCommentHovered != nullptr && IsSelected(GroupCommentHovered))
-		return true;
-
-	return false;
-}
-
 bool NodeArea::IsAnyGroupCommentInResizeMode()
 {
 	for (size_t i = 0; i < GroupComments.size(); i++)
@@ -7,40 +7,153 @@ void NodeArea::AddNode(Node* NewNode)
 		return;
 
 	NewNode->ParentArea = this;
-	Nodes.push_back(NewNode);
+	NewNode->AreaHandle = Nodes.Insert(NewNode);
+	NodeGeometry.Add(NewNode);
+	AddToTopologicalOrder(NewNode);
+	TopologyVersion++;
+
+	if (bTransactionActive)
+		RecordTransaction(TRANSACTION_NODE_ADDED, NewNode);
 }
 
-std::vector<Connection*> NodeArea::GetAllConnections(const NodeSocket* Socket) const
+void NodeArea::DetachNode(Node* Node)
 {
-	std::vector<Connection*> Result;
+	UnSelect(Node);
+	NodeGeometry.SwapRemove(Nodes.GetElementIndex(Node->AreaHandle));
+	Nodes.Remove(Node->AreaHandle);
+	RemoveFromTopologicalOrder(Node);
+	TopologyVersion++;
+	Node->bDirty = false;
+
+	// Inside transaction node could be restored by abort, so its pending work is dropped only by commit.
+	if (bTransactionActive)
+		return;
 
-	for (size_t i = 0; i < Connections.size(); i++)
+	CancelAsync(Node);
+}
+
+// Node specific event callbacks are removed together with node.
+void NodeArea::DestroyNode(Node* Node)
+{
+	RemoveNodeEventCallbacksOf(Node);
+
+	// Queue could still hold events of node, they are dropped on delivery, so node is deleted once queue was processed.
+	if (!SocketEventQueue.IsEmpty())
 	{
-		if (Connections[i]->In == Socket || Connections[i]->Out == Socket)
-			Result.push_back(Connections[i]);
+		NodesWaitingForSocketEvents.push_back(Node);
+		return;
 	}
 
-	return Result;
+	delete Node;
+}
+
+void NodeArea::DestroyNodesWaitingForSocketEvents()
+{
+	if (NodesWaitingForSocketEvents.empty() || bTransactionActive || !SocketEventQueue.IsEmpty())
+		return;
+
+	// Events that scheduler or delivery limit kept for later Update could reference these nodes.
+	RemoveSocketEventsOfDetachedNodes();
+	for (size_t i = 0; i < NodesWaitingForSocketEvents.size(); i++)
+		delete NodesWaitingForSocketEvents[i];
+	NodesWaitingForSocketEvents.clear();
+}
+
+std::vector<Connection*> NodeArea::GetAllConnections(const NodeSocket* Socket) const
+{
+	if (Socket == nullptr)
+		return std::vector<Connection*>();
+
+	return Socket->Connections;
 }
 
 Connection* NodeArea::GetConnection(const NodeSocket* FirstSocket, const NodeSocket* SecondSocket) const
 {
-	for (size_t i = 0; i < Connections.size(); i++)
+	if (FirstSocket == nullptr)
+		return nullptr;
+
+	for (size_t i = 0; i < FirstSocket->Connections.size(); i++)
 	{
-		if ((Connections[i]->In == FirstSocket && Connections[i]->Out == SecondSocket) || (Connections[i]->In == SecondSocket && Connections[i]->Out == FirstSocket))
-			return Connections[i];
+		Connection* CurrentConnection = FirstSocket->Connections[i];
+		if ((CurrentConnection->In == FirstSocket && CurrentConnection->Out == SecondSocket) || (CurrentConnection->In == SecondSocket && CurrentConnection->Out == FirstSocket))
+			return CurrentConnection;
 	}
 
 	return nullptr;
 }
 
-void NodeArea::Delete(Connection* Connection)
+static void RemoveConnectionFromSocket(std::vector<Connection*>& SocketConnections, const Connection* ConnectionToRemove)
 {
-	if (HoveredConnection == Connection)
-		HoveredConnection = nullptr;
+	for (size_t i = 0; i < SocketConnections.size(); i++)
+	{
+		if (SocketConnections[i] == ConnectionToRemove)
+		{
+			SocketConnections[i] = SocketConnections.back();
+			SocketConnections.pop_back();
+			return;
+		}
+	}
+}
+
+Connection* NodeArea::CreateConnection(NodeSocket* OutSocket, NodeSocket* InSocket)
+{
+	Connection* NewConnection = ConnectionPool.Create(OutSocket, InSocket);
+	NewConnection->AreaHandle = Connections.Insert(NewConnection);
+	OutSocket->Connections.push_back(NewConnection);
+	InSocket->Connections.push_back(NewConnection);
+	InSocket->GetParent()->InvalidateOutputData();
+	TopologyVersion++;
+
+	// Downstream of dirty node should stay dirty, otherwise MarkDirty would stop before reaching new consumer.
+	if (OutSocket->GetParent()->bDirty)
+		MarkDirty(InSocket->GetParent());
+
+	return NewConnection;
+}
+
+void NodeArea::DestroyConnection(Connection* Connection)
+{
+	for (size_t i = 0; i < Connection->RerouteNodes.size(); i++)
+		DestroyRerouteNode(Connection->RerouteNodes[i]);
+	Connection->RerouteNodes.clear();
+
+	RemoveConnectionFromSocket(Connection->Out->Connections, Connection);
+	RemoveConnectionFromSocket(Connection->In->Connections, Connection);
+	Connection->In->GetParent()->InvalidateOutputData();
+	TopologyVersion++;
+	Connections.Remove(Connection->AreaHandle);
+	ConnectionPool.Destroy(Connection);
+
+	// Removed connection could have been part of a cycle.
+	if (bTopologicalOrderCyclic)
+	{
+		bTopologicalOrderCyclic = false;
+		bTopologicalOrderDirty = true;
+	}
+}
 
+RerouteNode* NodeArea::CreateRerouteNode(Connection* Parent)
+{
+	RerouteNode* NewReroute = RerouteNodePool.Create();
+	NewReroute->AreaHandle = AllRerouteNodes.Insert(NewReroute);
+	NewReroute->Parent = Parent;
+
+	return NewReroute;
+}
+
+void NodeArea::DestroyRerouteNode(RerouteNode* RerouteNode)
+{
+	AllRerouteNodes.Remove(RerouteNode->AreaHandle);
+	RerouteNodePool.Destroy(RerouteNode);
+}
+
+void NodeArea::Delete(Connection* Connection)
+{
 	UnSelect(Connection);
 
+	if (bTransactionActive)
+		RecordConnectionRemoval(Connection);
+
 	for (size_t i = 0; i < Connection->RerouteNodes.size(); i++)
 	{
 		Delete(Connection->RerouteNodes[i]);
@@ -80,7 +193,8 @@ void NodeArea::Delete(Connection* Connection)
 		{
 			Connection->In->ConnectedSockets.erase(Connection->In->ConnectedSockets.begin() + i, Connection->In->ConnectedSockets.begin() + i + 1);
 			// To-Do : Add some variation of disconnected event, like DISCONNECTED_INCOMING
-			Connection->In->Parent->SocketEvent(Connection->In, Connection->Out, bClearing ? DESTRUCTION : DISCONNECTED);
+			if (!bTransactionActive)
+				Connection->In->Parent->SocketEvent(Connection->In, Connection->Out, bClearing ? DESTRUCTION : DISCONNECTED);
 			i--;
 		}
 	}
@@ -95,15 +209,8 @@ void NodeArea::Delete(Connection* Connection)
 		}
 	}
 
-	for (size_t i = 0; i < Connections.size(); i++)
-	{
-		if (Connections[i] == Connection)
-		{
-			delete Connection;
-			Connections.erase(Connections.begin() + i, Connections.begin() + i + 1);
-			break;
-		}
-	}
+	if (Connections.Get(Connection->AreaHandle) == Connection)
+		DestroyConnection(Connection);
 
 	if (!bClearing)
 	{
@@ -116,9 +223,6 @@ void NodeArea::Delete(Connection* Connection)
 
 void NodeArea::Delete(RerouteNode* RerouteNode)
 {
-	if (RerouteNodeHovered == RerouteNode)
-		RerouteNodeHovered = nullptr;
-
 	UnSelect(RerouteNode);
 
 	Connection* Connection = RerouteNode->Parent;
@@ -132,6 +236,14 @@ void NodeArea::Delete(RerouteNode* RerouteNode)
 		}
 	}
 
+	if (bTransactionActive)
+	{
+		RecordTransaction(TRANSACTION_REROUTE_REMOVED, nullptr, Connection->Out, Connection->In);
+		TransactionLog.back().RerouteNodeIDs.push_back(RerouteNode->ID);
+		TransactionLog.back().RerouteNodePositions.push_back(RerouteNode->Position);
+		TransactionLog.back().RerouteNodeIndex = IndexOfRerouteNode;
+	}
+
 	if (Connection->RerouteNodes.size() > 1)
 	{
 		// If the reroute node is the first one, we need to update the begin socket of the next one
@@ -159,7 +271,7 @@ void NodeArea::Delete(RerouteNode* RerouteNode)
 
 	if (!Connection->RerouteNodes.empty())
 	{
-		delete RerouteNode;
+		DestroyRerouteNode(RerouteNode);
 		Connection->RerouteNodes.erase(Connection->RerouteNodes.begin() + IndexOfRerouteNode, Connection->RerouteNodes.begin() + IndexOfRerouteNode + 1);
 	}
 }
@@ -185,39 +297,196 @@ void NodeArea::Delete(GroupComment* GroupComment)
 
 void NodeArea::DeleteNode(const Node* Node)
 {
-	if (!Node->bCouldBeDestroyed)
+	if (Node == nullptr || !Node->bCouldBeDestroyed)
 		return;
 
-	for (size_t i = 0; i < Nodes.size(); i++)
+	VisNodeSys::Node* NodeToDelete = Nodes.Get(Node->AreaHandle);
+	if (NodeToDelete != Node)
+		return;
+
+	PropagateNodeEventsCallbacks(NodeToDelete, REMOVED);
+
+	for (size_t j = 0; j < NodeToDelete->Input.size(); j++)
+	{
+		auto Connections = GetAllConnections(NodeToDelete->Input[j]);
+		for (size_t p = 0; p < Connections.size(); p++)
+		{
+			Delete(Connections[p]);
+		}
+	}
+
+	for (size_t j = 0; j < NodeToDelete->Output.size(); j++)
+	{
+		auto Connections = GetAllConnections(NodeToDelete->Output[j]);
+		for (size_t p = 0; p < Connections.size(); p++)
+		{
+			Delete(Connections[p]);
+		}
+	}
+
+	const bool bWasDirty = NodeToDelete->bDirty;
+	DetachNode(NodeToDelete);
+
+	// Node is destroyed on commit, abort could still return it back.
+	if (bTransactionActive)
+	{
+		RecordTransaction(TRANSACTION_NODE_REMOVED, NodeToDelete);
+		TransactionLog.back().bWasDirty = bWasDirty;
+		return;
+	}
+
+	// Clear drops all pending events at once.
+	if (!bClearing)
+		RemoveSocketEventsOfDetachedNodes();
+	DestroyNode(NodeToDelete);
+}
+
+void NodeArea::RemoveSocketFromConnected(std::vector<NodeSocket*>& ConnectedSockets, const NodeSocket* SocketToRemove)
+{
+	for (size_t i = 0; i < ConnectedSockets.size(); i++)
 	{
-		if (Nodes[i] == Node)
+		if (ConnectedSockets[i] == SocketToRemove)
 		{
-			PropagateNodeEventsCallbacks(Nodes[i], REMOVED);
+			ConnectedSockets.erase(ConnectedSockets.begin() + i);
+			i--;
+		}
+	}
+}
+
+// Unselecting elements one by one would search selection for each of them, so selection is filtered once.
+void NodeArea::UnSelectDeletedElements(const std::vector<Node*>& DeletedNodes, const std::vector<Connection*>& DeletedConnections)
+{
+	for (size_t i = 0; i < DeletedNodes.size(); i++)
+	{
+		uint8_t* Flags = GetNodeGeometryFlags(DeletedNodes[i]);
+		if (Flags != nullptr)
+			*Flags &= ~NODE_GEOMETRY_SELECTED;
+	}
+
+	for (size_t i = 0; i < DeletedConnections.size(); i++)
+	{
+		DeletedConnections[i]->bSelected = false;
+		for (size_t j = 0; j < DeletedConnections[i]->RerouteNodes.size(); j++)
+			DeletedConnections[i]->RerouteNodes[j]->bSelected = false;
+	}
+
+	SelectedNodes.erase(std::remove_if(SelectedNodes.begin(), SelectedNodes.end(), [this](const Node* Node) { return !IsSelected(Node); }), SelectedNodes.end());
+	SelectedConnections.erase(std::remove_if(SelectedConnections.begin(), SelectedConnections.end(), [](const Connection* Connection) { return !Connection->bSelected; }), SelectedConnections.end());
+	SelectedRerouteNodes.erase(std::remove_if(SelectedRerouteNodes.begin(), SelectedRerouteNodes.end(), [](const RerouteNode* RerouteNode) { return !RerouteNode->bSelected; }), SelectedRerouteNodes.end());
+}
 
-			for (size_t j = 0; j < Nodes[i]->Input.size(); j++)
+void NodeArea::DeleteNodes(const std::vector<Node*>& NodesToDelete)
+{
+	// Inside transaction every removal should be recorded, so nodes are deleted one by one.
+	if (bTransactionActive)
+	{
+		for (size_t i = 0; i < NodesToDelete.size(); i++)
+			DeleteNode(NodesToDelete[i]);
+
+		return;
+	}
+
+	// Flags are indexed by dense node index, which stays stable until nodes are removed at the end.
+	std::vector<uint8_t> MarkedForDeletion(Nodes.size(), 0);
+	std::vector<Node*> NodesThatWillBeDeleted;
+	NodesThatWillBeDeleted.reserve(NodesToDelete.size());
+	for (size_t i = 0; i < NodesToDelete.size(); i++)
+	{
+		Node* CurrentNode = NodesToDelete[i];
+		if (CurrentNode == nullptr || !CurrentNode->bCouldBeDestroyed || Nodes.Get(CurrentNode->AreaHandle) != CurrentNode)
+			continue;
+
+		const size_t NodeIndex = Nodes.GetElementIndex(CurrentNode->AreaHandle);
+		if (MarkedForDeletion[NodeIndex])
+			continue;
+
+		MarkedForDeletion[NodeIndex] = 1;
+		NodesThatWillBeDeleted.push_back(CurrentNode);
+	}
+
+	if (NodesThatWillBeDeleted.empty())
+		return;
+
+	for (size_t i = 0; i < NodesThatWillBeDeleted.size(); i++)
+		PropagateNodeEventsCallbacks(NodesThatWillBeDeleted[i], REMOVED);
+
+	// Connection between two deleted nodes is collected only once, from output socket.
+	std::vector<Connection*> ConnectionsToDelete;
+	std::vector<Node*> NodesToNotify;
+	std::vector<uint8_t> MarkedForNotification(Nodes.size(), 0);
+	for (size_t i = 0; i < NodesThatWillBeDeleted.size(); i++)
+	{
+		const Node* CurrentNode = NodesThatWillBeDeleted[i];
+		for (size_t j = 0; j < CurrentNode->Output.size(); j++)
+		{
+			const std::vector<Connection*>& SocketConnections = CurrentNode->Output[j]->Connections;
+			for (size_t k = 0; k < SocketConnections.size(); k++)
 			{
-				auto Connections = GetAllConnections(Nodes[i]->Input[j]);
-				for (size_t p = 0; p < Connections.size(); p++)
+				ConnectionsToDelete.push_back(SocketConnections[k]);
+
+				Node* OtherNode = SocketConnections[k]->In->Parent;
+				const size_t OtherNodeIndex = Nodes.GetElementIndex(OtherNode->AreaHandle);
+				if (!MarkedForDeletion[OtherNodeIndex] && !MarkedForNotification[OtherNodeIndex])
 				{
-					Delete(Connections[p]);
+					MarkedForNotification[OtherNodeIndex] = 1;
+					NodesToNotify.push_back(OtherNode);
 				}
 			}
+		}
 
-			for (size_t j = 0; j < Nodes[i]->Output.size(); j++)
+		for (size_t j = 0; j < CurrentNode->Input.size(); j++)
+		{
+			const std::vector<Connection*>& SocketConnections = CurrentNode->Input[j]->Connections;
+			for (size_t k = 0; k < SocketConnections.size(); k++)
 			{
-				auto Connections = GetAllConnections(Nodes[i]->Output[j]);
-				for (size_t p = 0; p < Connections.size(); p++)
+				Node* OtherNode = SocketConnections[k]->Out->Parent;
+				const size_t OtherNodeIndex = Nodes.GetElementIndex(OtherNode->AreaHandle);
+				if (MarkedForDeletion[OtherNodeIndex])
+					continue;
+
+				ConnectionsToDelete.push_back(SocketConnections[k]);
+				if (!MarkedForNotification[OtherNodeIndex])
 				{
-					Delete(Connections[p]);
+					MarkedForNotification[OtherNodeIndex] = 1;
+					NodesToNotify.push_back(OtherNode);
 				}
 			}
+		}
+	}
 
-			delete Nodes[i];
-			Nodes.erase(Nodes.begin() + i, Nodes.begin() + i + 1);
+	if (!bClearing)
+	{
+		for (size_t i = 0; i < NodesToNotify.size(); i++)
+			PropagateNodeEventsCallbacks(NodesToNotify[i], BEFORE_DISCONNECTED);
+	}
 
-			break;
-		}
+	UnSelectDeletedElements(NodesThatWillBeDeleted, ConnectionsToDelete);
+
+	for (size_t i = 0; i < ConnectionsToDelete.size(); i++)
+	{
+		Connection* CurrentConnection = ConnectionsToDelete[i];
+		RemoveSocketFromConnected(CurrentConnection->In->ConnectedSockets, CurrentConnection->Out);
+		RemoveSocketFromConnected(CurrentConnection->Out->ConnectedSockets, CurrentConnection->In);
+
+		Node* InNode = CurrentConnection->In->Parent;
+		if (!MarkedForDeletion[Nodes.GetElementIndex(InNode->AreaHandle)])
+			InNode->SocketEvent(CurrentConnection->In, CurrentConnection->Out, bClearing ? DESTRUCTION : DISCONNECTED);
+
+		DestroyConnection(CurrentConnection);
 	}
+
+	if (!bClearing)
+	{
+		for (size_t i = 0; i < NodesToNotify.size(); i++)
+			PropagateNodeEventsCallbacks(NodesToNotify[i], AFTER_DISCONNECTED);
+	}
+
+	for (size_t i = 0; i < NodesThatWillBeDeleted.size(); i++)
+		DetachNode(NodesThatWillBeDeleted[i]);
+
+	RemoveSocketEventsOfDetachedNodes();
+	for (size_t i = 0; i < NodesThatWillBeDeleted.size(); i++)
+		DestroyNode(NodesThatWillBeDeleted[i]);
 }
 
 void NodeArea::PropagateUpdateToConnectedNodes(const Node* CallerNode) const
@@ -225,15 +494,6 @@ void NodeArea::PropagateUpdateToConnectedNodes(const Node* CallerNode) const
 	if (CallerNode == nullptr)
 		return;
 
-	for (size_t i = 0; i < CallerNode->Input.size(); i++)
-	{
-		auto Connections = GetAllConnections(CallerNode->Input[i]);
-		for (size_t j = 0; j < Connections.size(); j++)
-		{
-			Connections[j]->In->GetParent()->SocketEvent(Connections[j]->In, Connections[j]->Out, UPDATE);
-		}
-	}
-
 	for (size_t i = 0; i < CallerNode->Output.size(); i++)
 	{
 		auto Connections = GetAllConnections(CallerNode->Output[i]);
@@ -255,13 +515,32 @@ bool NodeArea::TryToConnect(const Node* OutNode, const size_t OutNodeSocketIndex
 	if (InNode->Input.size() <= InNodeSocketIndex)
 		return false;
 
-	NodeSocket* OutSocket = OutNode->Output[OutNodeSocketIndex];
-	NodeSocket* InSocket = InNode->Input[InNodeSocketIndex];
+	return TryToConnectSockets(OutNode->Output[OutNodeSocketIndex], InNode->Input[InNodeSocketIndex]);
+}
 
+bool NodeArea::TryToConnectSockets(NodeSocket* OutSocket, NodeSocket* InSocket)
+{
 	char* Message = nullptr;
-	const bool Result = InSocket->GetParent()->CanConnect(InSocket, OutSocket, &Message);
+	bool Result = InSocket->GetParent()->CanConnect(InSocket, OutSocket, &Message);
+	if (Result && !UpdateTopologicalOrder(OutSocket->GetParent(), InSocket->GetParent()))
+		Result = false;
+
+	if (Result && bTransactionActive)
+	{
+		OutSocket->ConnectedSockets.push_back(InSocket);
+		InSocket->ConnectedSockets.push_back(OutSocket);
+
+		CreateConnection(OutSocket, InSocket);
+		RecordTransaction(TRANSACTION_CONNECTION_ADDED, nullptr, OutSocket, InSocket);
+	}
+	else if (Result && BatchDepth > 0)
+	{
+		OutSocket->ConnectedSockets.push_back(InSocket);
+		InSocket->ConnectedSockets.push_back(OutSocket);
 
-	if (Result)
+		BatchConnections.push_back(CreateConnection(OutSocket, InSocket)->AreaHandle);
+	}
+	else if (Result)
 	{
 		PropagateNodeEventsCallbacks(OutSocket->GetParent(), BEFORE_CONNECTED);
 		PropagateNodeEventsCallbacks(InSocket->GetParent(), BEFORE_CONNECTED);
@@ -269,7 +548,7 @@ bool NodeArea::TryToConnect(const Node* OutNode, const size_t OutNodeSocketIndex
 		OutSocket->ConnectedSockets.push_back(InSocket);
 		InSocket->ConnectedSockets.push_back(OutSocket);
 
-		Connections.push_back(new Connection(OutSocket, InSocket));
+		CreateConnection(OutSocket, InSocket);
 
 		OutSocket->GetParent()->SocketEvent(OutSocket, InSocket, CONNECTED);
 		InSocket->GetParent()->SocketEvent(InSocket, OutSocket, CONNECTED);
@@ -281,6 +560,156 @@ bool NodeArea::TryToConnect(const Node* OutNode, const size_t OutNodeSocketIndex
 	return Result;
 }
 
+void NodeArea::BeginBatch(const size_t ExpectedNodeCount, const size_t ExpectedConnectionCount)
+{
+	BatchDepth++;
+
+	Nodes.reserve(Nodes.size() + ExpectedNodeCount);
+	NodeGeometry.Reserve(Nodes.size() + ExpectedNodeCount);
+	Connections.reserve(Connections.size() + ExpectedConnectionCount);
+	ConnectionPool.Reserve(ExpectedConnectionCount);
+	BatchConnections.reserve(BatchConnections.size() + ExpectedConnectionCount);
+}
+
+void NodeArea::EndBatch()
+{
+	if (BatchDepth == 0)
+		return;
+
+	BatchDepth--;
+	if (BatchDepth > 0)
+		return;
+
+	// Callbacks could connect or delete elements, so everything is referenced by handles.
+	std::vector<SlotHandle> NewConnections;
+	NewConnections.swap(BatchConnections);
+
+	std::vector<SlotHandle> NodesToNotify;
+	std::vector<uint8_t> MarkedForNotification(Nodes.size(), 0);
+	for (size_t i = 0; i < NewConnections.size(); i++)
+	{
+		const Connection* CurrentConnection = Connections.Get(NewConnections[i]);
+		if (CurrentConnection == nullptr)
+			continue;
+
+		const Node* ConnectedNodes[2] = { CurrentConnection->Out->Parent, CurrentConnection->In->Parent };
+		for (size_t j = 0; j < 2; j++)
+		{
+			const size_t NodeIndex = Nodes.GetElementIndex(ConnectedNodes[j]->AreaHandle);
+			if (!MarkedForNotification[NodeIndex])
+			{
+				MarkedForNotification[NodeIndex] = 1;
+				NodesToNotify.push_back(ConnectedNodes[j]->AreaHandle);
+			}
+		}
+	}
+
+	for (size_t i = 0; i < NodesToNotify.size(); i++)
+	{
+		Node* NodeToNotify = Nodes.Get(NodesToNotify[i]);
+		if (NodeToNotify != nullptr)
+			PropagateNodeEventsCallbacks(NodeToNotify, BEFORE_CONNECTED);
+	}
+
+	for (size_t i = 0; i < NewConnections.size(); i++)
+	{
+		Connection* CurrentConnection = Connections.Get(NewConnections[i]);
+		if (CurrentConnection == nullptr)
+			continue;
+
+		NodeSocket* OutSocket = CurrentConnection->Out;
+		NodeSocket* InSocket = CurrentConnection->In;
+		OutSocket->GetParent()->SocketEvent(OutSocket, InSocket, CONNECTED);
+		InSocket->GetParent()->SocketEvent(InSocket, OutSocket, CONNECTED);
+	}
+
+	for (size_t i = 0; i < NodesToNotify.size(); i++)
+	{
+		Node* NodeToNotify = Nodes.Get(NodesToNotify[i]);
+		if (NodeToNotify != nullptr)
+			PropagateNodeEventsCallbacks(NodeToNotify, AFTER_CONNECTED);
+	}
+}
+
+bool NodeArea::IsInBatch() const
+{
+	return BatchDepth > 0;
+}
+
+void NodeArea::AddNodes(const std::vector<Node*>& NewNodes)
+{
+	Nodes.reserve(Nodes.size() + NewNodes.size());
+	NodeGeometry.Reserve(Nodes.size() + NewNodes.size());
+
+	for (size_t i = 0; i < NewNodes.size(); i++)
+		AddNode(NewNodes[i]);
+}
+
+size_t NodeArea::ConnectNodes(const std::vector<Node*>& NodesToConnect, const std::vector<NodeAreaBatchConnection>& ConnectionsToCreate)
+{
+	size_t Result = 0;
+	BeginBatch(0, ConnectionsToCreate.size());
+
+	for (size_t i = 0; i < ConnectionsToCreate.size(); i++)
+	{
+		const NodeAreaBatchConnection& Description = ConnectionsToCreate[i];
+		if (Description.OutNodeIndex >= NodesToConnect.size() || Description.InNodeIndex >= NodesToConnect.size())
+			continue;
+
+		if (TryToConnect(NodesToConnect[Description.OutNodeIndex], Description.OutSocketIndex, NodesToConnect[Description.InNodeIndex], Description.InSocketIndex))
+			Result++;
+	}
+
+	EndBatch();
+	return Result;
+}
+
+static bool FindSocketIndexByID(const std::vector<NodeSocket*>& Sockets, const std::string& SocketID, size_t& Index)
+{
+	for (size_t i = 0; i < Sockets.size(); i++)
+	{
+		if (Sockets[i]->GetID() == SocketID)
+		{
+			Index = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t NodeArea::ConnectNodes(const std::vector<NodeAreaBatchConnectionByID>& ConnectionsToCreate)
+{
+	std::unordered_map<std::string, Node*> IDToNode;
+	IDToNode.reserve(Nodes.size());
+	for (size_t i = 0; i < Nodes.size(); i++)
+		IDToNode[Nodes[i]->GetID()] = Nodes[i];
+
+	size_t Result = 0;
+	BeginBatch(0, ConnectionsToCreate.size());
+
+	for (size_t i = 0; i < ConnectionsToCreate.size(); i++)
+	{
+		const NodeAreaBatchConnectionByID& Description = ConnectionsToCreate[i];
+		const auto OutNodeIterator = IDToNode.find(Description.OutNodeID);
+		const auto InNodeIterator = IDToNode.find(Description.InNodeID);
+		if (OutNodeIterator == IDToNode.end() || InNodeIterator == IDToNode.end())
+			continue;
+
+		size_t OutSocketIndex = 0;
+		size_t InSocketIndex = 0;
+		if (!FindSocketIndexByID(OutNodeIterator->second->Output, Description.OutSocketID, OutSocketIndex) ||
+			!FindSocketIndexByID(InNodeIterator->second->Input, Description.InSocketID, InSocketIndex))
+			continue;
+
+		if (TryToConnect(OutNodeIterator->second, OutSocketIndex, InNodeIterator->second, InSocketIndex))
+			Result++;
+	}
+
+	EndBatch();
+	return Result;
+}
+
 bool NodeArea::TryToDisconnect(const Node* OutNode, size_t OutNodeSocketIndex, const Node* InNode, size_t InNodeSocketIndex)
 {
 	if (OutNode == nullptr || InNode == nullptr)
@@ -397,48 +826,10 @@ void NodeArea::RunOnEachConnectedNode(Node* StartNode, void(*Func)(Node*))
 	if (Func == nullptr)
 		return;
 
-	static std::unordered_map<Node*, bool> SeenNodes;
-	SeenNodes.clear();
-	auto bWasNodeSeen = [](Node* Node) {
-		if (SeenNodes.find(Node) == SeenNodes.end())
-		{
-			SeenNodes[Node] = true;
-			return false;
-		}
-
+	TraverseNodes(StartNode, [Func](Node* CurrentNode) {
+		Func(CurrentNode);
 		return true;
-	};
-	
-	std::vector<Node*> CurrentNodes;
-	CurrentNodes.push_back(StartNode);
-	if (bWasNodeSeen(StartNode))
-		return;
-
-	while (!IsEmptyOrFilledByNulls(CurrentNodes))
-	{
-		for (int i = 0; i < static_cast<int>(CurrentNodes.size()); i++)
-		{
-			if (CurrentNodes[i] == nullptr)
-			{
-				CurrentNodes.erase(CurrentNodes.begin() + i);
-				i--;
-				continue;
-			}
-
-			Func(CurrentNodes[i]);
-
-			std::vector<Node*> NewNodes = CurrentNodes[i]->GetNodesConnectedToOutput();
-			for (size_t j = 0; j < NewNodes.size(); j++)
-			{
-				CurrentNodes.push_back(NewNodes[j]);
-				if (bWasNodeSeen(NewNodes[j]))
-					return;
-			}
-
-			CurrentNodes.erase(CurrentNodes.begin() + i);
-			i--;
-		}
-	}
+	});
 }
 
 bool NodeArea::TryToConnect(const Node* OutNode, const std::string OutSocketID, const Node* InNode, const std::string InSocketID)
@@ -470,6 +861,14 @@ bool NodeArea::TryToConnect(const Node* OutNode, const std::string OutSocketID,
 }
 
 bool NodeArea::TriggerSocketEvent(NodeSocket* CallerNodeSocket, NodeSocket* TriggeredNodeSocket, NODE_SOCKET_EVENT EventType)
+{
+	if (TriggeredNodeSocket == nullptr || TriggeredNodeSocket->GetParent() == nullptr)
+		return false;
+
+	return TriggerSocketEvent(CallerNodeSocket, TriggeredNodeSocket, EventType, TriggeredNodeSocket->GetParent()->EventPriority);
+}
+
+bool NodeArea::TriggerSocketEvent(NodeSocket* CallerNodeSocket, NodeSocket* TriggeredNodeSocket, NODE_SOCKET_EVENT EventType, const int Priority)
 {
 	if (CallerNodeSocket == nullptr || TriggeredNodeSocket == nullptr)
 		return false;
@@ -480,7 +879,7 @@ bool NodeArea::TriggerSocketEvent(NodeSocket* CallerNodeSocket, NodeSocket* Trig
 	if (TriggeredNodeSocket->GetParent() == nullptr)
 		return false;
 
-	SocketEventQueue.push({ TriggeredNodeSocket, CallerNodeSocket, EventType });
+	SocketEventQueue.Push({ TriggeredNodeSocket, CallerNodeSocket, EventType, Priority });
 
 	return true;
 }
@@ -498,14 +897,95 @@ bool NodeArea::TriggerOrphanSocketEvent(Node* Node, NODE_SOCKET_EVENT EventType)
 	return true;
 }
 
+bool NodeArea::IsCoalescingSocketEvents() const
+{
+	return Settings.bCoalesceSocketEvents;
+}
+
+void NodeArea::SetCoalescingSocketEvents(const bool NewValue)
+{
+	Settings.bCoalesceSocketEvents = NewValue;
+}
+
+size_t NodeArea::GetCoalescedSocketEventCount() const
+{
+	return CoalescedSocketEventCount;
+}
+
+void NodeArea::ResetCoalescedSocketEventCount()
+{
+	CoalescedSocketEventCount = 0;
+}
+
 void NodeArea::ProcessSocketEventQueue()
 {
-	while (!SocketEventQueue.empty())
+	SocketEventFlushIndex++;
+	CarriedOverSocketEvents.clear();
+	CarriedOverSocketEvents.swap(DeferredSocketEvents);
+
+	// Events that scheduler still holds are delivered by it even after it was turned off.
+	if (Settings.bScheduleSocketEvents || !ScheduledSocketEvents.empty())
 	{
-		SocketEvent Event = SocketEventQueue.front();
-		SocketEventQueue.pop();
+		ProcessScheduledSocketEvents();
+		return;
+	}
 
-		Event.TriggeredNodeSocket->GetParent()->SocketEvent(Event.TriggeredNodeSocket, Event.CallerNodeSocket, Event.EventType);
+	if (Settings.bCoalesceSocketEvents)
+	{
+		ProcessCoalescedSocketEvents();
+		return;
+	}
+
+	// Removed nodes leave nullptr in carried over events.
+	for (size_t i = 0; i < CarriedOverSocketEvents.size(); i++)
+	{
+		if (CarriedOverSocketEvents[i].TriggeredNodeSocket != nullptr)
+			DeliverSocketEvent(CarriedOverSocketEvents[i]);
+	}
+	CarriedOverSocketEvents.clear();
+
+	SocketEvent Event;
+	while (SocketEventQueue.TryPop(Event))
+		DeliverSocketEvent(Event);
+}
+
+// Events are taken in batches of everything that is pending, events triggered during delivery form next batch.
+void NodeArea::ProcessCoalescedSocketEvents()
+{
+	const auto AddToBatch = [this](const SocketEvent& Event) {
+		uint32_t& EventTypes = SocketEventsInBatch[Event.TriggeredNodeSocket];
+		const uint32_t EventBit = 1u << Event.EventType;
+		if (EventTypes & EventBit)
+		{
+			CoalescedSocketEventCount++;
+			return;
+		}
+
+		EventTypes |= EventBit;
+		SocketEventBatch.push_back(Event);
+	};
+
+	SocketEvent Event;
+	while (true)
+	{
+		SocketEventBatch.clear();
+		SocketEventsInBatch.clear();
+		for (size_t i = 0; i < CarriedOverSocketEvents.size(); i++)
+			AddToBatch(CarriedOverSocketEvents[i]);
+		CarriedOverSocketEvents.clear();
+
+		while (SocketEventQueue.TryPop(Event))
+			AddToBatch(Event);
+
+		if (SocketEventBatch.empty())
+			break;
+
+		// Removed nodes leave nullptr in batch.
+		for (size_t i = 0; i < SocketEventBatch.size(); i++)
+		{
+			if (SocketEventBatch[i].TriggeredNodeSocket != nullptr)
+				DeliverSocketEvent(SocketEventBatch[i]);
+		}
 	}
 }
 
@@ -514,9 +994,8 @@ bool NodeArea::AddRerouteNode(Connection* Connection, size_t SegmentToDivide, Im
 	if (Connection == nullptr)
 		return false;
 
-	RerouteNode* NewReroute = new RerouteNode();
-	NewReroute->ID = NODE_CORE.GetUniqueHexID();
-	NewReroute->Parent = Connection;
+	RerouteNode* NewReroute = CreateRerouteNode(Connection);
+	NewReroute->ID = Context->GetUniqueHexID();
 	NewReroute->Position = Position;
 
 	if (Connection->RerouteNodes.empty())
@@ -563,7 +1042,7 @@ bool NodeArea::AddRerouteNode(Connection* Connection, size_t SegmentToDivide, Im
 		}
 	}
 
-	delete NewReroute;
+	DestroyRerouteNode(NewReroute);
 	return false;
 }
 
@@ -730,18 +1209,12 @@ std::vector<Node*> NodeArea::GetNodesInGroupComment(GroupComment* GroupCommentTo
 	if (GroupCommentToCheck == nullptr)
 		return Result;
 
-	for (size_t i = 0; i < Nodes.size(); i++)
+	const ImVec2 CommentPosition = GroupCommentToCheck->GetPosition();
+	const ImVec2 CommentSize = GroupCommentToCheck->GetSize();
+	for (size_t i = 0; i < NodeGeometry.Size(); i++)
 	{
-		if (Nodes[i]->GetStyle() == DEFAULT)
-		{
-			if (IsSecondRectInsideFirstOne(GroupCommentToCheck->GetPosition(), GroupCommentToCheck->GetSize(), Nodes[i]->GetPosition(), Nodes[i]->GetSize()))
-				Result.push_back(Nodes[i]);
-		}
-		else if (Nodes[i]->GetStyle() == CIRCLE)
-		{
-			if (IsSecondRectInsideFirstOne(GroupCommentToCheck->GetPosition(), GroupCommentToCheck->GetSize(), Nodes[i]->GetPosition(), ImVec2(NODE_DIAMETER, NODE_DIAMETER)))
-				Result.push_back(Nodes[i]);
-		}
+		if (IsSecondRectInsideFirstOne(CommentPosition, CommentSize, ImVec2(NodeGeometry.X[i], NodeGeometry.Y[i]), NodeGeometry.GetExtent(i)))
+			Result.push_back(Nodes[i]);
 	}
 
 	return Result;
@@ -48,7 +48,7 @@ void NodeArea::RenderNode(Node* Node) const
 	ImGui::SetCursorScreenPos(Node->LeftTop);
 
 	// Drawing node background layer.
-	const ImU32 NodeBackgroundColor = (HoveredNode == Node || IsSelected(Node)) ? ImGui::GetColorU32(Settings.Style.NodeBackgroundColor) : ImGui::GetColorU32(Settings.Style.HoveredNodeBackgroundColor);
+	const ImU32 NodeBackgroundColor = (GetHovered() == Node || IsSelected(Node)) ? ImGui::GetColorU32(Settings.Style.NodeBackgroundColor) : ImGui::GetColorU32(Settings.Style.HoveredNodeBackgroundColor);
 	if (Node->GetStyle() == DEFAULT)
 	{
 		CurrentDrawList->AddRectFilled(Node->LeftTop, Node->RightBottom, NodeBackgroundColor, 8.0f * Zoom);
@@ -65,7 +65,7 @@ void NodeArea::RenderNode(Node* Node) const
 		// Drawing caption area.
 		ImVec2 TitleArea = Node->RightBottom;
 		TitleArea.y = Node->LeftTop.y + GetNodeTitleHeight();
-		const ImU32 NodeTitleBackgroundColor = (HoveredNode == Node || IsSelected(Node)) ? Node->TitleBackgroundColorHovered : Node->TitleBackgroundColor;
+		const ImU32 NodeTitleBackgroundColor = (GetHovered() == Node || IsSelected(Node)) ? Node->TitleBackgroundColorHovered : Node->TitleBackgroundColor;
 
 		CurrentDrawList->AddRectFilled(Node->LeftTop + ImVec2(1, 1), TitleArea, NodeTitleBackgroundColor, 8.0f * Zoom);
 		CurrentDrawList->AddRect(Node->LeftTop, Node->RightBottom, ImColor(100, 100, 100), 8.0f * Zoom);
@@ -98,11 +98,35 @@ void NodeArea::RenderNode(Node* Node) const
 		CurrentDrawList->AddCircle(Node->LeftTop + ImVec2(NODE_DIAMETER / 2.0f, NODE_DIAMETER / 2.0f) * Zoom, NODE_DIAMETER * Zoom + 2.0f, ImColor(100, 100, 100), 32, 2.0f);
 	}
 
+	if (Node->IsBusy())
+		RenderNodeBusyIndicator(Node);
+
 	RenderNodeSockets(Node);
 
 	ImGui::PopID();
 }
 
+// Rotating arc, in right corner of title or around circle node.
+void NodeArea::RenderNodeBusyIndicator(const Node* Node) const
+{
+	const float StartAngle = static_cast<float>(ImGui::GetTime()) * 2.0f * IM_PI;
+	const ImU32 Color = ImGui::GetColorU32(Settings.Style.NodeBusyIndicatorColor);
+
+	if (Node->GetStyle() == DEFAULT)
+	{
+		const float Radius = GetNodeTitleHeight() / 4.0f;
+		const ImVec2 Center = ImVec2(Node->RightBottom.x - GetNodeTitleHeight() / 2.0f, Node->LeftTop.y + GetNodeTitleHeight() / 2.0f);
+		CurrentDrawList->PathArcTo(Center, Radius, StartAngle, StartAngle + 1.5f * IM_PI, 12);
+		CurrentDrawList->PathStroke(Color, 0, 2.0f * Zoom);
+	}
+	else if (Node->GetStyle() == CIRCLE)
+	{
+		const ImVec2 Center = Node->LeftTop + ImVec2(NODE_DIAMETER / 2.0f, NODE_DIAMETER / 2.0f) * Zoom;
+		CurrentDrawList->PathArcTo(Center, NODE_DIAMETER * Zoom + 6.0f, StartAngle, StartAngle + 0.5f * IM_PI, 12);
+		CurrentDrawList->PathStroke(Color, 0, 3.0f);
+	}
+}
+
 void NodeArea::RenderNodeSockets(const Node* Node) const
 {
 	for (size_t i = 0; i < Node->Input.size(); i++)
@@ -133,8 +157,7 @@ void NodeArea::RenderNodeSocket(NodeSocket* Socket) const
 	}
 
 	ImColor SocketColor = DEFAULT_NODE_SOCKET_COLOR;
-	if (NodeSocket::SocketTypeToColorAssosiations.find(Socket->GetType()) != NodeSocket::SocketTypeToColorAssosiations.end())
-		SocketColor = NodeSocket::SocketTypeToColorAssosiations[Socket->GetType()];
+	Context->GetSocketTypeColor(Socket->GetType(), SocketColor);
 
 	ImColor SocketInternalPartColor = ImColor(30, 30, 30);
 	if (SocketHovered == Socket)
@@ -165,8 +188,7 @@ void NodeArea::RenderNodeSocket(NodeSocket* Socket) const
 		static ConnectionStyle DefaultConnectionStyle;
 
 		ImColor ConnectionColor = ImColor(200, 200, 200);
-		if (NodeSocket::SocketTypeToColorAssosiations.find(SocketLookingForConnection->GetType()) != NodeSocket::SocketTypeToColorAssosiations.end())
-			ConnectionColor = NodeSocket::SocketTypeToColorAssosiations[SocketLookingForConnection->GetType()];
+		Context->GetSocketTypeColor(SocketLookingForConnection->GetType(), ConnectionColor);
 		
 		CurrentDrawList->ChannelsSetCurrent(3);
 		DrawHermiteLine(SocketPosition, ImGui::GetIO().MousePos, Settings.Style.GeneralConnection.LineSegments, ConnectionColor, &DefaultConnectionStyle);
@@ -530,8 +552,7 @@ void NodeArea::RenderConnection(const Connection* Connection) const
 		return;
 
 	ImColor CurrentConnectionColor = Connection->Style.ForceColor;
-	if (NodeSocket::SocketTypeToColorAssosiations.find(Connection->Out->GetType()) != NodeSocket::SocketTypeToColorAssosiations.end())
-		CurrentConnectionColor = NodeSocket::SocketTypeToColorAssosiations[Connection->Out->GetType()];
+	Context->GetSocketTypeColor(Connection->Out->GetType(), CurrentConnectionColor);
 
 	std::vector<ConnectionSegment> Segments = GetConnectionSegments(Connection);
 	for (size_t i = 0; i < Segments.size(); i++)
@@ -570,129 +591,6 @@ void NodeArea::RenderReroute(const RerouteNode* RerouteNode) const
 	CurrentDrawList->AddCircleFilled(LocalToScreen(RerouteNode->Position), GetRerouteNodeSize(), ImColor(DEFAULT_NODE_SOCKET_COLOR.Value + ImColor(15, 25, 15).Value));
 }
 
-ImVec2 NodeArea::SocketToPosition(const NodeSocket* Socket) const
-{
-	const bool Input = !Socket->bOutput;
-	float SocketX = 0.0f;
-	float SocketY = 0.0f;
-
-	int SocketIndex = -1;
-	if (Input)
-	{
-		for (size_t i = 0; i < Socket->Parent->Input.size(); i++)
-		{
-			if (Socket->Parent->Input[i] == Socket)
-			{
-				SocketIndex = static_cast<int>(i);
-				break;
-			}
-		}
-	}
-	else
-	{
-		for (size_t i = 0; i < Socket->Parent->Output.size(); i++)
-		{
-			if (Socket->Parent->Output[i] == Socket)
-			{
-				SocketIndex = static_cast<int>(i);
-				break;
-			}
-		}
-	}
-
-	if (Socket->GetParent()->GetStyle() == DEFAULT)
-	{
-		SocketX = Input ? Socket->Parent->LeftTop.x + GetNodeSocketSize() * 3 : Socket->Parent->RightBottom.x - GetNodeSocketSize() * 3;
-
-		const float HeightForSockets = Socket->Parent->GetSize().y * Zoom - GetNodeTitleHeight();
-		const float SocketSpacing = HeightForSockets / (Input ? Socket->Parent->Input.size() : Socket->Parent->Output.size());
-
-		SocketY = (Socket->Parent->LeftTop.y + GetNodeTitleHeight() + SocketSpacing * (SocketIndex + 1) - SocketSpacing / 2.0f);
-	}
-	else if (Socket->GetParent()->GetStyle() == CIRCLE)
-	{
-		const size_t SocketCount = Input ? Socket->Parent->Input.size() : Socket->Parent->Output.size();
-		float BeginAngle = (180.0f / static_cast<float>(SocketCount) / 2.0f);
-		if (Input)
-			BeginAngle = -BeginAngle;
-
-		float step = (180.0f / static_cast<float>(SocketCount) * (SocketIndex));
-		if (Input)
-			step = -step;
-
-		const float angle = BeginAngle + step;
-
-		const float NodeCenterX = Socket->Parent->LeftTop.x + NODE_DIAMETER * Zoom / 2.0f;
-		const float NodeCenterY = Socket->Parent->LeftTop.y + NODE_DIAMETER * Zoom / 2.0f;
-
-		SocketX = NodeCenterX + NODE_DIAMETER * Zoom * 0.95f * sin(glm::radians(angle));
-		SocketY = NodeCenterY + NODE_DIAMETER * Zoom * 0.95f * cos(glm::radians(angle));
-	}
-
-	return {SocketX, SocketY};
-}
-
-ImVec2 NodeArea::GetRenderOffset() const
-{
-	return RenderOffset;
-}
-
-void NodeArea::SetRenderOffset(const ImVec2 Offset)
-{
-	if (Offset.x <= -Settings.Style.Grid.GRID_SIZE || Offset.x >= Settings.Style.Grid.GRID_SIZE ||
-		Offset.y <= -Settings.Style.Grid.GRID_SIZE || Offset.y >= Settings.Style.Grid.GRID_SIZE)
-		return;
-
-	RenderOffset = Offset;
-}
-
-void NodeArea::GetAllElementsAABB(ImVec2& Min, ImVec2& Max) const
-{
-	Min.x = FLT_MAX;
-	Min.y = FLT_MAX;
-
-	Max.x = -FLT_MAX;
-	Max.y = -FLT_MAX;
-
-	for (size_t i = 0; i < Nodes.size(); i++)
-	{
-		if (Nodes[i]->GetPosition().x + RenderOffset.x < Min.x)
-			Min.x = Nodes[i]->GetPosition().x + RenderOffset.x;
-
-		if (Nodes[i]->GetPosition().x + RenderOffset.x + Nodes[i]->GetSize().x > Max.x)
-			Max.x = Nodes[i]->GetPosition().x + RenderOffset.x + Nodes[i]->GetSize().x;
-
-		if (Nodes[i]->GetPosition().y + RenderOffset.y < Min.y)
-			Min.y = Nodes[i]->GetPosition().y + RenderOffset.y;
-
-		if (Nodes[i]->GetPosition().y + RenderOffset.y + Nodes[i]->GetSize().y > Max.y)
-			Max.y = Nodes[i]->GetPosition().y + RenderOffset.y + Nodes[i]->GetSize().y;
-	}
-
-	for (size_t i = 0; i < GroupComments.size(); i++)
-	{
-		if (GroupComments[i]->GetPosition().x + RenderOffset.x < Min.x)
-			Min.x = GroupComments[i]->GetPosition().x + RenderOffset.x;
-
-		if (GroupComments[i]->GetPosition().x + RenderOffset.x + GroupComments[i]->GetSize().x > Max.x)
-			Max.x = GroupComments[i]->GetPosition().x + RenderOffset.x + GroupComments[i]->GetSize().x;
-
-		if (GroupComments[i]->GetPosition().y + RenderOffset.y < Min.y)
-			Min.y = GroupComments[i]->GetPosition().y + RenderOffset.y;
-
-		if (GroupComments[i]->GetPosition().y + RenderOffset.y + GroupComments[i]->GetSize().y > Max.y)
-			Max.y = GroupComments[i]->GetPosition().y + RenderOffset.y + GroupComments[i]->GetSize().y;
-	}
-}
-
-ImVec2 NodeArea::GetAllElementsAABBCenter() const
-{
-	ImVec2 min, max;
-	GetAllElementsAABB(min, max);
-
-	return {min.x + (max.x - min.x) / 2.0f, min.y + (max.y - min.y) / 2.0f};
-}
-
 ImVec2 NodeArea::GetRenderedViewCenter() const
 {
 	if (NodeAreaWindow != nullptr)
@@ -705,16 +603,6 @@ ImVec2 NodeArea::GetRenderedViewCenter() const
 	}
 }
 
-bool NodeArea::IsFillingWindow()
-{
-	return bFillWindow;
-}
-
-void NodeArea::SetIsFillingWindow(bool NewValue)
-{
-	bFillWindow = NewValue;
-}
-
 void NodeArea::ApplyZoom(float Delta)
 {
 	ImVec2 MousePosBeforeZoom = ScreenToLocal(ImGui::GetMousePos());
@@ -731,79 +619,6 @@ void NodeArea::ApplyZoom(float Delta)
 	Settings.Style.GeneralConnection.LineSegments = static_cast<int>(16 * Zoom);
 }
 
-float NodeArea::GetZoomFactor() const
-{
-	return Zoom;
-}
-
-void NodeArea::SetZoomFactor(float NewValue)
-{
-	if (NewValue < MIN_ZOOM_LEVEL || NewValue > MAX_ZOOM_LEVEL)
-		return;
-
-	Zoom = NewValue;
-}
-
-bool NodeArea::GetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle& Style) const
-{
-	if (Node == nullptr || SocketIndex < 0)
-		return false;
-
-	if (bOutputSocket)
-	{
-		if (SocketIndex >= Node->Output.size())
-			return false;
-
-		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Output[SocketIndex]);
-		if (TempVariable != nullptr)
-		{
-			Style = *TempVariable;
-			return true;
-		}
-
-		return false;
-	}
-	else
-	{
-		if (SocketIndex >= Node->Input.size())
-			return false;
-
-		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Input[SocketIndex]);
-		if (TempVariable != nullptr)
-		{
-			Style = *TempVariable;
-			return true;
-		}
-
-		return false;
-	}
-}
-
-void NodeArea::SetConnectionStyle(Node* Node, bool bOutputSocket, size_t SocketIndex, ConnectionStyle NewStyle)
-{
-	if (Node == nullptr || SocketIndex < 0)
-		return;
-
-	if (bOutputSocket)
-	{
-		if (SocketIndex >= Node->Output.size())
-			return;
-
-		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Output[SocketIndex]);
-		if (TempVariable != nullptr)
-			*TempVariable = NewStyle;
-	}
-	else
-	{
-		if (SocketIndex >= Node->Input.size())
-			return;
-
-		ConnectionStyle* TempVariable = GetConnectionStyle(Node->Input[SocketIndex]);
-		if (TempVariable != nullptr)
-			*TempVariable = NewStyle;
-	}
-}
-
 void NodeArea::RenderGroupComment(GroupComment* GroupComment)
 {
 	if (CurrentDrawList == nullptr || GroupComment == nullptr)
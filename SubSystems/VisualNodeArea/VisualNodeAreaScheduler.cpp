@@ -0,0 +1,282 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+bool NodeArea::IsSchedulingSocketEvents() const
+{
+	return Settings.bScheduleSocketEvents;
+}
+
+void NodeArea::SetSchedulingSocketEvents(const bool NewValue)
+{
+	Settings.bScheduleSocketEvents = NewValue;
+}
+
+float NodeArea::GetSocketEventTimeBudget() const
+{
+	return Settings.SocketEventTimeBudget;
+}
+
+void NodeArea::SetSocketEventTimeBudget(const float Milliseconds)
+{
+	Settings.SocketEventTimeBudget = Milliseconds < 0.0f ? 0.0f : Milliseconds;
+}
+
+NodeAreaSocketEventStatistics NodeArea::GetSocketEventStatistics() const
+{
+	NodeAreaSocketEventStatistics Result = SocketEventStatistics;
+	Result.QueueDepth = ScheduledSocketEvents.size();
+	return Result;
+}
+
+void NodeArea::ResetSocketEventStatistics()
+{
+	SocketEventStatistics = NodeAreaSocketEventStatistics();
+}
+
+// Heap keeps largest element on top, so event that should be delivered first is the largest one.
+bool NodeArea::ScheduledSocketEventOrder(const ScheduledSocketEvent& First, const ScheduledSocketEvent& Second)
+{
+	if (First.Event.Priority != Second.Event.Priority)
+		return First.Event.Priority < Second.Event.Priority;
+
+	return First.Sequence > Second.Sequence;
+}
+
+void NodeArea::ProcessScheduledSocketEvents()
+{
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point Now = Clock::now();
+	const bool bBudgeted = Settings.bScheduleSocketEvents && Settings.SocketEventTimeBudget > 0.0f;
+	const Clock::time_point Deadline = Now + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(Settings.SocketEventTimeBudget));
+
+	// With coalescing SocketEventsInBatch describes events that are in heap.
+	if (ScheduledSocketEvents.empty())
+		SocketEventsInBatch.clear();
+
+	const auto Schedule = [this, &Now](const SocketEvent& Event) {
+		if (Settings.bCoalesceSocketEvents)
+		{
+			uint32_t& EventTypes = SocketEventsInBatch[Event.TriggeredNodeSocket];
+			const uint32_t EventBit = 1u << Event.EventType;
+			if (EventTypes & EventBit)
+			{
+				CoalescedSocketEventCount++;
+				return;
+			}
+
+			EventTypes |= EventBit;
+		}
+
+		ScheduledSocketEvents.push_back({ Event, SocketEventSequence++, Now });
+		std::push_heap(ScheduledSocketEvents.begin(), ScheduledSocketEvents.end(), ScheduledSocketEventOrder);
+	};
+
+	for (size_t i = 0; i < CarriedOverSocketEvents.size(); i++)
+		Schedule(CarriedOverSocketEvents[i]);
+	CarriedOverSocketEvents.clear();
+
+	size_t DeliveredCount = 0;
+	SocketEvent Event;
+	while (true)
+	{
+		// Queue is checked after every delivery, so that urgent events triggered by it are delivered in this Update.
+		while (SocketEventQueue.TryPop(Event))
+			Schedule(Event);
+
+		if (ScheduledSocketEvents.size() > SocketEventStatistics.MaxQueueDepth)
+			SocketEventStatistics.MaxQueueDepth = ScheduledSocketEvents.size();
+
+		if (ScheduledSocketEvents.empty())
+			break;
+
+		if (bBudgeted && DeliveredCount > 0 && Now >= Deadline)
+		{
+			SocketEventStatistics.BudgetExceededUpdates++;
+			break;
+		}
+
+		std::pop_heap(ScheduledSocketEvents.begin(), ScheduledSocketEvents.end(), ScheduledSocketEventOrder);
+		const ScheduledSocketEvent Current = ScheduledSocketEvents.back();
+		ScheduledSocketEvents.pop_back();
+
+		if (Settings.bCoalesceSocketEvents)
+			SocketEventsInBatch[Current.Event.TriggeredNodeSocket] &= ~(1u << Current.Event.EventType);
+
+		const double WaitTime = std::chrono::duration<double, std::milli>(Now - Current.ArrivalTime).count();
+		if (DeliverSocketEvent(Current.Event))
+		{
+			SocketEventStatistics.TotalWaitTime += WaitTime;
+			if (WaitTime > SocketEventStatistics.MaxWaitTime)
+				SocketEventStatistics.MaxWaitTime = WaitTime;
+			SocketEventStatistics.DeliveredEvents++;
+			DeliveredCount++;
+		}
+		Now = Clock::now();
+	}
+}
+
+// Events that wait for later Update would otherwise reference sockets of destroyed nodes.
+void NodeArea::RemoveSocketEventsOfDetachedNodes()
+{
+	if (CarriedOverSocketEvents.empty() && SocketEventBatch.empty() && DeferredSocketEvents.empty() && ScheduledSocketEvents.empty())
+		return;
+
+	const auto References = [this](const SocketEvent& Event) {
+		return IsDetachedNode(Event.TriggeredNodeSocket->GetParent()) || IsDetachedNode(Event.CallerNodeSocket->GetParent());
+	};
+
+	for (size_t i = 0; i < CarriedOverSocketEvents.size(); i++)
+	{
+		if (CarriedOverSocketEvents[i].TriggeredNodeSocket != nullptr && References(CarriedOverSocketEvents[i]))
+			CarriedOverSocketEvents[i].TriggeredNodeSocket = nullptr;
+	}
+
+	for (size_t i = 0; i < SocketEventBatch.size(); i++)
+	{
+		if (SocketEventBatch[i].TriggeredNodeSocket != nullptr && References(SocketEventBatch[i]))
+			SocketEventBatch[i].TriggeredNodeSocket = nullptr;
+	}
+
+	DeferredSocketEvents.erase(std::remove_if(DeferredSocketEvents.begin(), DeferredSocketEvents.end(), References), DeferredSocketEvents.end());
+
+	if (ScheduledSocketEvents.empty())
+		return;
+
+	size_t NewSize = 0;
+	for (size_t i = 0; i < ScheduledSocketEvents.size(); i++)
+	{
+		const SocketEvent& Event = ScheduledSocketEvents[i].Event;
+		if (!References(Event))
+		{
+			ScheduledSocketEvents[NewSize++] = ScheduledSocketEvents[i];
+			continue;
+		}
+
+		std::unordered_map<const NodeSocket*, uint32_t>::iterator EventTypes = SocketEventsInBatch.find(Event.TriggeredNodeSocket);
+		if (EventTypes != SocketEventsInBatch.end())
+			EventTypes->second &= ~(1u << Event.EventType);
+	}
+
+	if (NewSize == ScheduledSocketEvents.size())
+		return;
+
+	ScheduledSocketEvents.resize(NewSize);
+	std::make_heap(ScheduledSocketEvents.begin(), ScheduledSocketEvents.end(), ScheduledSocketEventOrder);
+}
+
+size_t NodeArea::GetMaxSocketEventDeliveries() const
+{
+	return Settings.MaxSocketEventDeliveriesPerFlush;
+}
+
+void NodeArea::SetMaxSocketEventDeliveries(const size_t NewValue)
+{
+	Settings.MaxSocketEventDeliveriesPerFlush = NewValue;
+}
+
+size_t NodeArea::GetDeferredSocketEventCount() const
+{
+	return DeferredSocketEvents.size();
+}
+
+void NodeArea::SetEventStormCallback(std::function<void(const NodeAreaEventStormReport&)> Callback)
+{
+	EventStormCallback = std::move(Callback);
+}
+
+bool NodeArea::DeliverSocketEvent(const SocketEvent& Event)
+{
+	NodeSocket* Socket = Event.TriggeredNodeSocket;
+	// Events of removed nodes could still wait in queue, node removed inside transaction could be restored by abort,
+	// so its events wait for end of transaction.
+	if (IsDetachedNode(Socket->GetParent()) || IsDetachedNode(Event.CallerNodeSocket->GetParent()))
+	{
+		if (bTransactionActive)
+			DeferredSocketEvents.push_back(Event);
+
+		return false;
+	}
+
+	if (Socket->EventFlushIndex != SocketEventFlushIndex)
+	{
+		Socket->EventFlushIndex = SocketEventFlushIndex;
+		Socket->EventDeliveryCount = 0;
+	}
+
+	const size_t Limit = Settings.MaxSocketEventDeliveriesPerFlush;
+	if (Limit > 0 && Socket->EventDeliveryCount >= Limit)
+	{
+		// Count goes over limit only once, so storm is reported once per flush.
+		if (Socket->EventDeliveryCount == Limit)
+		{
+			ReportEventStorm(Socket);
+			Socket->EventDeliveryCount++;
+		}
+
+		DeferredSocketEvents.push_back(Event);
+		return false;
+	}
+
+	Socket->EventDeliveryCount++;
+	Socket->LastEventCaller = Event.CallerNodeSocket;
+	Socket->GetParent()->SocketEvent(Socket, Event.CallerNodeSocket, Event.EventType);
+	return true;
+}
+
+// Path goes back from socket through last callers. Node of caller could have several sockets,
+// the one with most deliveries in this flush is taken as the reason of its events.
+void NodeArea::ReportEventStorm(const NodeSocket* Socket)
+{
+	if (!EventStormCallback)
+		return;
+
+	NodeAreaEventStormReport Report;
+	Report.NodeID = Socket->GetParent()->GetID();
+	Report.SocketID = Socket->GetID();
+	Report.Deliveries = Socket->EventDeliveryCount;
+
+	// Last caller could belong to node that was removed during this flush.
+	std::vector<const NodeSocket*> LiveSockets;
+	for (size_t i = 0; i < Nodes.size(); i++)
+	{
+		LiveSockets.insert(LiveSockets.end(), Nodes[i]->Input.begin(), Nodes[i]->Input.end());
+		LiveSockets.insert(LiveSockets.end(), Nodes[i]->Output.begin(), Nodes[i]->Output.end());
+	}
+	std::sort(LiveSockets.begin(), LiveSockets.end());
+
+	std::vector<Node*> PathNodes;
+	PathNodes.push_back(Socket->GetParent());
+	const NodeSocket* CurrentSocket = Socket;
+	while (CurrentSocket != nullptr)
+	{
+		const NodeSocket* Caller = CurrentSocket->LastEventCaller;
+		if (Caller == nullptr || !std::binary_search(LiveSockets.begin(), LiveSockets.end(), Caller))
+			break;
+
+		Node* CallerNode = Caller->GetParent();
+		Report.bCycle = std::find(PathNodes.begin(), PathNodes.end(), CallerNode) != PathNodes.end();
+		PathNodes.push_back(CallerNode);
+		if (Report.bCycle)
+			break;
+
+		CurrentSocket = nullptr;
+		uint32_t MaxDeliveryCount = 0;
+		const auto ConsiderSockets = [&](const std::vector<NodeSocket*>& Sockets) {
+			for (size_t i = 0; i < Sockets.size(); i++)
+			{
+				if (Sockets[i]->EventFlushIndex == SocketEventFlushIndex && Sockets[i]->EventDeliveryCount > MaxDeliveryCount)
+				{
+					MaxDeliveryCount = Sockets[i]->EventDeliveryCount;
+					CurrentSocket = Sockets[i];
+				}
+			}
+		};
+		ConsiderSockets(CallerNode->Input);
+		ConsiderSockets(CallerNode->Output);
+	}
+
+	for (size_t i = PathNodes.size(); i > 0; i--)
+		Report.Path.push_back(PathNodes[i - 1]->GetID());
+
+	EventStormCallback(Report);
+}
\ No newline at end of file
@@ -0,0 +1,288 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+Node* NodeArea::GetHovered() const
+{
+	return Nodes.Get(HoveredNodeHandle);
+}
+
+Connection* NodeArea::GetHoveredConnection() const
+{
+	return Connections.Get(HoveredConnectionHandle);
+}
+
+RerouteNode* NodeArea::GetHoveredRerouteNode() const
+{
+	return AllRerouteNodes.Get(RerouteNodeHoveredHandle);
+}
+
+// Selection vectors keep selection order, membership is stored on elements themselves.
+// Recently selected elements are usually the first to be unselected, so search starts from the end.
+template<typename T>
+static T* RemoveFromSelection(std::vector<T*>& Selection, const T* Element)
+{
+	for (size_t i = Selection.size(); i > 0; i--)
+	{
+		if (Selection[i - 1] == Element)
+		{
+			T* Result = Selection[i - 1];
+			Selection.erase(Selection.begin() + (i - 1));
+			return Result;
+		}
+	}
+
+	return nullptr;
+}
+
+std::vector<Node*> NodeArea::GetSelected()
+{
+	return SelectedNodes;
+}
+
+uint8_t* NodeArea::GetNodeGeometryFlags(const Node* Node)
+{
+	if (Node == nullptr || Nodes.Get(Node->AreaHandle) != Node)
+		return nullptr;
+
+	return &NodeGeometry.Flags[Nodes.GetElementIndex(Node->AreaHandle)];
+}
+
+const uint8_t* NodeArea::GetNodeGeometryFlags(const Node* Node) const
+{
+	if (Node == nullptr || Nodes.Get(Node->AreaHandle) != Node)
+		return nullptr;
+
+	return &NodeGeometry.Flags[Nodes.GetElementIndex(Node->AreaHandle)];
+}
+
+bool NodeArea::AddSelected(Node* Node)
+{
+	uint8_t* Flags = GetNodeGeometryFlags(Node);
+	if (Flags == nullptr)
+		return false;
+
+	if (*Flags & NODE_GEOMETRY_SELECTED)
+		return false;
+
+	*Flags |= NODE_GEOMETRY_SELECTED;
+	SelectedNodes.push_back(Node);
+	return true;
+}
+
+bool NodeArea::IsSelected(const Node* Node) const
+{
+	const uint8_t* Flags = GetNodeGeometryFlags(Node);
+	if (Flags == nullptr)
+		return false;
+
+	return (*Flags & NODE_GEOMETRY_SELECTED) != 0;
+}
+
+bool NodeArea::UnSelect(const Node* Node)
+{
+	uint8_t* Flags = GetNodeGeometryFlags(Node);
+	if (Flags == nullptr || !(*Flags & NODE_GEOMETRY_SELECTED))
+		return false;
+
+	*Flags &= ~NODE_GEOMETRY_SELECTED;
+	return RemoveFromSelection(SelectedNodes, Node) != nullptr;
+}
+
+void NodeArea::UnSelectAllNodes()
+{
+	for (size_t i = 0; i < SelectedNodes.size(); i++)
+	{
+		uint8_t* Flags = GetNodeGeometryFlags(SelectedNodes[i]);
+		if (Flags != nullptr)
+			*Flags &= ~NODE_GEOMETRY_SELECTED;
+	}
+
+	SelectedNodes.clear();
+}
+
+void NodeArea::SelectNodesInRegion(const ImVec2 RegionMin, const ImVec2 RegionMax)
+{
+	UnSelectAllNodes();
+
+	for (size_t i = 0; i < NodeGeometry.Size(); i++)
+	{
+		const ImVec2 NodePosition = ImVec2(NodeGeometry.X[i], NodeGeometry.Y[i]);
+		const ImVec2 NodeExtent = NodeGeometry.GetExtent(i);
+		bool bInRegion;
+		if (Settings.bRequireFullOverlapToSelect)
+		{
+			bInRegion = IsSecondRectInsideFirstOne(RegionMin, RegionMax - RegionMin, NodePosition, NodeExtent);
+		}
+		else
+		{
+			bInRegion = IsRectsOverlaping(NodePosition, NodeExtent, RegionMin, RegionMax - RegionMin);
+		}
+
+		if (bInRegion)
+			AddSelected(Nodes[i]);
+	}
+}
+
+bool NodeArea::AddSelected(Connection* Connection)
+{
+	if (Connection == nullptr)
+		return false;
+
+	if (IsSelected(Connection))
+		return false;
+
+	Connection->bSelected = true;
+	SelectedConnections.push_back(Connection);
+	return true;
+}
+
+bool NodeArea::IsSelected(const Connection* Connection) const
+{
+	if (Connection == nullptr)
+		return false;
+
+	return Connection->bSelected;
+}
+
+bool NodeArea::UnSelect(const Connection* Connection)
+{
+	if (Connection == nullptr || !Connection->bSelected)
+		return false;
+
+	VisNodeSys::Connection* Removed = RemoveFromSelection(SelectedConnections, Connection);
+	if (Removed == nullptr)
+		return false;
+
+	Removed->bSelected = false;
+	return true;
+}
+
+void NodeArea::UnSelectAllConnections()
+{
+	for (size_t i = 0; i < SelectedConnections.size(); i++)
+	{
+		SelectedConnections[i]->bSelected = false;
+	}
+
+	SelectedConnections.clear();
+}
+
+bool NodeArea::AddSelected(GroupComment* GroupComment)
+{
+	if (GroupComment == nullptr)
+		return false;
+
+	if (IsSelected(GroupComment))
+		return false;
+
+	GroupComment->bSelected = true;
+	SelectedGroupComments.push_back(GroupComment);
+	AttachElemetnsToGroupComment(GroupComment);
+
+	return true;
+}
+
+bool NodeArea::IsSelected(const GroupComment* GroupComment) const
+{
+	if (GroupComment == nullptr)
+		return false;
+
+	return GroupComment->bSelected;
+}
+
+bool NodeArea::UnSelect(GroupComment* GroupComment)
+{
+	if (GroupComment == nullptr || !GroupComment->bSelected)
+		return false;
+
+	if (RemoveFromSelection(SelectedGroupComments, GroupComment) == nullptr)
+		return false;
+
+	GroupComment->bSelected = false;
+	GroupComment->AttachedNodes.clear();
+	GroupComment->AttachedRerouteNodes.clear();
+	GroupComment->AttachedGroupComments.clear();
+
+	return true;
+}
+
+void NodeArea::UnSelectAllGroupComments()
+{
+	for (size_t i = 0; i < SelectedGroupComments.size(); i++)
+	{
+		SelectedGroupComments[i]->bSelected = false;
+	}
+
+	SelectedGroupComments.clear();
+}
+
+bool NodeArea::AddSelected(RerouteNode* RerouteNode)
+{
+	if (RerouteNode == nullptr)
+		return false;
+
+	if (IsSelected(RerouteNode))
+		return false;
+
+	RerouteNode->bSelected = true;
+	SelectedRerouteNodes.push_back(RerouteNode);
+	return true;
+}
+
+bool NodeArea::IsSelected(const RerouteNode* RerouteNode) const
+{
+	if (RerouteNode == nullptr)
+		return false;
+
+	return RerouteNode->bSelected;
+}
+
+bool NodeArea::UnSelect(const RerouteNode* RerouteNode)
+{
+	if (RerouteNode == nullptr || !RerouteNode->bSelected)
+		return false;
+
+	VisNodeSys::RerouteNode* Removed = RemoveFromSelection(SelectedRerouteNodes, RerouteNode);
+	if (Removed == nullptr)
+		return false;
+
+	Removed->bSelected = false;
+	return true;
+}
+
+void NodeArea::UnSelectAllRerouteNodes()
+{
+	for (size_t i = 0; i < SelectedRerouteNodes.size(); i++)
+	{
+		SelectedRerouteNodes[i]->bSelected = false;
+	}
+
+	SelectedRerouteNodes.clear();
+}
+
+void NodeArea::UnSelectAll()
+{
+	UnSelectAllNodes();
+	UnSelectAllConnections();
+	UnSelectAllRerouteNodes();
+	UnSelectAllGroupComments();
+}
+
+bool NodeArea::IsMouseHovered() const
+{
+	return bMouseHovered;
+}
+
+bool NodeArea::IsMouseAboveSomethingSelected() const
+{
+	if (GetHovered() != nullptr && IsSelected(GetHovered()))
+		return true;
+
+	if (GetHoveredRerouteNode() != nullptr && IsSelected(GetHoveredRerouteNode()))
+		return true;
+
+	if (GroupCommentHovered != nullptr && IsSelected(GroupCommentHovered))
+		return true;
+
+	return false;
+}
\ No newline at end of file
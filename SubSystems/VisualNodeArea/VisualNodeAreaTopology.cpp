@@ -0,0 +1,314 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+bool NodeArea::IsRejectingCycles() const
+{
+	return Settings.bRejectCycles;
+}
+
+void NodeArea::SetRejectingCycles(const bool NewValue)
+{
+	Settings.bRejectCycles = NewValue;
+}
+
+uint64_t NodeArea::GetTopologyVersion() const
+{
+	return TopologyVersion;
+}
+
+bool NodeArea::IsInTopologicalOrder(const Node* Node) const
+{
+	return Node->TopologicalIndex < TopologicalOrder.size() && TopologicalOrder[Node->TopologicalIndex] == Node;
+}
+
+void NodeArea::AddToTopologicalOrder(Node* Node)
+{
+	// Node without connections could be placed anywhere.
+	Node->TopologicalIndex = static_cast<uint32_t>(TopologicalOrder.size());
+	TopologicalOrder.push_back(Node);
+}
+
+void NodeArea::RemoveFromTopologicalOrder(Node* Node)
+{
+	if (!IsInTopologicalOrder(Node))
+		return;
+
+	TopologicalOrder[Node->TopologicalIndex] = nullptr;
+	Node->TopologicalIndex = UINT32_MAX;
+	TopologicalOrderHoles++;
+
+	// Removed node could have been part of a cycle.
+	if (bTopologicalOrderCyclic)
+	{
+		bTopologicalOrderCyclic = false;
+		bTopologicalOrderDirty = true;
+	}
+
+	if (TopologicalOrderHoles > 64 && TopologicalOrderHoles * 2 > TopologicalOrder.size())
+		CompactTopologicalOrder();
+}
+
+void NodeArea::CompactTopologicalOrder()
+{
+	size_t NewSize = 0;
+	for (size_t i = 0; i < TopologicalOrder.size(); i++)
+	{
+		if (TopologicalOrder[i] == nullptr)
+			continue;
+
+		TopologicalOrder[NewSize] = TopologicalOrder[i];
+		TopologicalOrder[NewSize]->TopologicalIndex = static_cast<uint32_t>(NewSize);
+		NewSize++;
+	}
+
+	TopologicalOrder.resize(NewSize);
+	TopologicalOrderHoles = 0;
+}
+
+// Kahn's algorithm, nodes that are left on cycles are appended at the end so that every node keeps a position.
+void NodeArea::RebuildTopologicalOrder()
+{
+	const size_t NodeCount = Nodes.size();
+	std::vector<uint32_t> IncomingCount(NodeCount, 0);
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		const Node* CurrentNode = Nodes[i];
+		for (size_t j = 0; j < CurrentNode->Input.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+			{
+				if (ContainsNode(ConnectedSockets[k]->GetParent()))
+					IncomingCount[i]++;
+			}
+		}
+	}
+
+	std::vector<Node*> NewOrder;
+	NewOrder.reserve(NodeCount);
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		if (IncomingCount[i] == 0)
+			NewOrder.push_back(Nodes[i]);
+	}
+
+	for (size_t i = 0; i < NewOrder.size(); i++)
+	{
+		const Node* CurrentNode = NewOrder[i];
+		for (size_t j = 0; j < CurrentNode->Output.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+			{
+				Node* ConnectedNode = ConnectedSockets[k]->GetParent();
+				if (!ContainsNode(ConnectedNode))
+					continue;
+
+				const size_t ConnectedNodeIndex = Nodes.GetElementIndex(ConnectedNode->AreaHandle);
+				IncomingCount[ConnectedNodeIndex]--;
+				if (IncomingCount[ConnectedNodeIndex] == 0)
+					NewOrder.push_back(ConnectedNode);
+			}
+		}
+	}
+
+	bTopologicalOrderCyclic = NewOrder.size() < NodeCount;
+	if (bTopologicalOrderCyclic)
+	{
+		for (size_t i = 0; i < NodeCount; i++)
+		{
+			if (IncomingCount[i] > 0)
+				NewOrder.push_back(Nodes[i]);
+		}
+	}
+
+	TopologicalOrder.swap(NewOrder);
+	for (size_t i = 0; i < TopologicalOrder.size(); i++)
+		TopologicalOrder[i]->TopologicalIndex = static_cast<uint32_t>(i);
+
+	TopologicalOrderHoles = 0;
+	bTopologicalOrderDirty = false;
+}
+
+void NodeArea::ResetTopologicalOrder()
+{
+	TopologyVersion++;
+	TopologicalOrder.clear();
+	TopologicalOrderHoles = 0;
+	bTopologicalOrderDirty = false;
+	bTopologicalOrderCyclic = false;
+}
+
+void NodeArea::ClearTopologicalVisited(const std::vector<Node*>& VisitedNodes)
+{
+	for (size_t i = 0; i < VisitedNodes.size(); i++)
+		TopologicalVisited[VisitedNodes[i]->TopologicalIndex] = 0;
+}
+
+bool NodeArea::UpdateTopologicalOrder(Node* OutNode, Node* InNode)
+{
+	if (!IsInTopologicalOrder(OutNode) || !IsInTopologicalOrder(InNode))
+		return true;
+
+	// Without rejection there is nothing to check, order would be rebuilt when it is requested.
+	if (!Settings.bRejectCycles && (bTopologicalOrderDirty || bTopologicalOrderCyclic))
+		return true;
+
+	// Batch could add many connections against order, rebuilding once is cheaper than reordering for each of them.
+	if (!Settings.bRejectCycles && BatchDepth > 0 && OutNode->TopologicalIndex > InNode->TopologicalIndex)
+	{
+		bTopologicalOrderDirty = true;
+		return true;
+	}
+
+	if (bTopologicalOrderDirty)
+		RebuildTopologicalOrder();
+
+	// Order could not help when graph already has cycles, so reachability is checked directly.
+	if (bTopologicalOrderCyclic)
+	{
+		return TraverseNodes(InNode, [OutNode](Node* CurrentNode) {
+			return CurrentNode != OutNode;
+		});
+	}
+
+	if (ReorderForConnection(OutNode, InNode))
+		return true;
+
+	if (Settings.bRejectCycles)
+		return false;
+
+	bTopologicalOrderCyclic = true;
+	return true;
+}
+
+// Pearce-Kelly dynamic topological sort.
+// Only nodes with positions between InNode and OutNode are visited: those reachable from InNode
+// and those that reach OutNode. They are moved so that the latter ones come first, keeping set of positions.
+bool NodeArea::ReorderForConnection(Node* OutNode, Node* InNode)
+{
+	if (OutNode == InNode)
+		return false;
+
+	const uint32_t LowerBound = InNode->TopologicalIndex;
+	const uint32_t UpperBound = OutNode->TopologicalIndex;
+	if (UpperBound < LowerBound)
+		return true;
+
+	if (TopologicalVisited.size() < TopologicalOrder.size())
+		TopologicalVisited.resize(TopologicalOrder.size(), 0);
+
+	TopologicalForward.clear();
+	TopologicalPending.clear();
+	TopologicalPending.push_back(InNode);
+	TopologicalVisited[LowerBound] = 1;
+	while (!TopologicalPending.empty())
+	{
+		Node* CurrentNode = TopologicalPending.back();
+		TopologicalPending.pop_back();
+		TopologicalForward.push_back(CurrentNode);
+
+		for (size_t i = 0; i < CurrentNode->Output.size(); i++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[i]->ConnectedSockets;
+			for (size_t j = 0; j < ConnectedSockets.size(); j++)
+			{
+				Node* ConnectedNode = ConnectedSockets[j]->GetParent();
+				if (ConnectedNode == OutNode)
+				{
+					ClearTopologicalVisited(TopologicalForward);
+					ClearTopologicalVisited(TopologicalPending);
+					return false;
+				}
+
+				if (!IsInTopologicalOrder(ConnectedNode) || ConnectedNode->TopologicalIndex > UpperBound || TopologicalVisited[ConnectedNode->TopologicalIndex])
+					continue;
+
+				TopologicalVisited[ConnectedNode->TopologicalIndex] = 1;
+				TopologicalPending.push_back(ConnectedNode);
+			}
+		}
+	}
+
+	TopologicalBackward.clear();
+	TopologicalPending.push_back(OutNode);
+	TopologicalVisited[UpperBound] = 1;
+	while (!TopologicalPending.empty())
+	{
+		Node* CurrentNode = TopologicalPending.back();
+		TopologicalPending.pop_back();
+		TopologicalBackward.push_back(CurrentNode);
+
+		for (size_t i = 0; i < CurrentNode->Input.size(); i++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[i]->ConnectedSockets;
+			for (size_t j = 0; j < ConnectedSockets.size(); j++)
+			{
+				Node* ConnectedNode = ConnectedSockets[j]->GetParent();
+				if (!IsInTopologicalOrder(ConnectedNode) || ConnectedNode->TopologicalIndex < LowerBound || TopologicalVisited[ConnectedNode->TopologicalIndex])
+					continue;
+
+				TopologicalVisited[ConnectedNode->TopologicalIndex] = 1;
+				TopologicalPending.push_back(ConnectedNode);
+			}
+		}
+	}
+
+	ClearTopologicalVisited(TopologicalForward);
+	ClearTopologicalVisited(TopologicalBackward);
+
+	const auto ByPosition = [](const Node* First, const Node* Second) {
+		return First->TopologicalIndex < Second->TopologicalIndex;
+	};
+	std::sort(TopologicalBackward.begin(), TopologicalBackward.end(), ByPosition);
+	std::sort(TopologicalForward.begin(), TopologicalForward.end(), ByPosition);
+
+	TopologicalPositions.clear();
+	for (size_t i = 0; i < TopologicalBackward.size(); i++)
+		TopologicalPositions.push_back(TopologicalBackward[i]->TopologicalIndex);
+	for (size_t i = 0; i < TopologicalForward.size(); i++)
+		TopologicalPositions.push_back(TopologicalForward[i]->TopologicalIndex);
+	std::sort(TopologicalPositions.begin(), TopologicalPositions.end());
+
+	size_t PositionIndex = 0;
+	for (size_t i = 0; i < TopologicalBackward.size(); i++)
+	{
+		TopologicalBackward[i]->TopologicalIndex = TopologicalPositions[PositionIndex];
+		TopologicalOrder[TopologicalPositions[PositionIndex++]] = TopologicalBackward[i];
+	}
+
+	for (size_t i = 0; i < TopologicalForward.size(); i++)
+	{
+		TopologicalForward[i]->TopologicalIndex = TopologicalPositions[PositionIndex];
+		TopologicalOrder[TopologicalPositions[PositionIndex++]] = TopologicalForward[i];
+	}
+
+	return true;
+}
+
+std::vector<Node*> NodeArea::GetTopologicalOrder()
+{
+	std::vector<Node*> Result;
+	if (bTopologicalOrderDirty)
+		RebuildTopologicalOrder();
+
+	if (bTopologicalOrderCyclic)
+		return Result;
+
+	Result.reserve(TopologicalOrder.size() - TopologicalOrderHoles);
+	for (size_t i = 0; i < TopologicalOrder.size(); i++)
+	{
+		if (TopologicalOrder[i] != nullptr)
+			Result.push_back(TopologicalOrder[i]);
+	}
+
+	return Result;
+}
+
+bool NodeArea::HasCycles()
+{
+	if (bTopologicalOrderDirty)
+		RebuildTopologicalOrder();
+
+	return bTopologicalOrderCyclic;
+}
\ No newline at end of file
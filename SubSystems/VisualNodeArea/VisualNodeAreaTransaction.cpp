@@ -0,0 +1,259 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+bool NodeArea::BeginTransaction()
+{
+	if (bTransactionActive)
+		return false;
+
+	bTransactionActive = true;
+	return true;
+}
+
+bool NodeArea::IsInTransaction() const
+{
+	return bTransactionActive;
+}
+
+void NodeArea::AddChangeSetCallback(std::function<void(const NodeAreaChangeSet&)> Func)
+{
+	if (Func != nullptr)
+		ChangeSetCallbacks.push_back(Func);
+}
+
+bool NodeArea::ContainsNode(const Node* Node) const
+{
+	return Node != nullptr && Nodes.Get(Node->AreaHandle) == Node;
+}
+
+// Node that was removed from this area but not yet destroyed, nodes moved to other area are not detached.
+bool NodeArea::IsDetachedNode(const Node* Node) const
+{
+	return Node != nullptr && Node->ParentArea == this && !ContainsNode(Node);
+}
+
+void NodeArea::RecordTransaction(const TRANSACTION_RECORD_TYPE Type, Node* Node, NodeSocket* OutSocket, NodeSocket* InSocket)
+{
+	TransactionRecord Record;
+	Record.Type = Type;
+	Record.TargetNode = Node;
+	Record.OutSocket = OutSocket;
+	Record.InSocket = InSocket;
+	TransactionLog.push_back(std::move(Record));
+}
+
+void NodeArea::RecordConnectionRemoval(const Connection* Connection)
+{
+	RecordTransaction(TRANSACTION_CONNECTION_REMOVED, nullptr, Connection->Out, Connection->In);
+
+	TransactionRecord& Record = TransactionLog.back();
+	for (size_t i = 0; i < Connection->RerouteNodes.size(); i++)
+	{
+		Record.RerouteNodeIDs.push_back(Connection->RerouteNodes[i]->ID);
+		Record.RerouteNodePositions.push_back(Connection->RerouteNodes[i]->Position);
+	}
+}
+
+void NodeArea::RestoreConnection(const TransactionRecord& Record)
+{
+	Record.OutSocket->ConnectedSockets.push_back(Record.InSocket);
+	Record.InSocket->ConnectedSockets.push_back(Record.OutSocket);
+	Connection* RestoredConnection = CreateConnection(Record.OutSocket, Record.InSocket);
+
+	for (size_t i = 0; i < Record.RerouteNodeIDs.size(); i++)
+	{
+		RerouteNode* NewReroute = CreateRerouteNode(RestoredConnection);
+		NewReroute->ID = Record.RerouteNodeIDs[i];
+		NewReroute->Position = Record.RerouteNodePositions[i];
+
+		if (i == 0)
+		{
+			NewReroute->BeginSocket = Record.OutSocket;
+		}
+		else
+		{
+			NewReroute->BeginReroute = RestoredConnection->RerouteNodes.back();
+			RestoredConnection->RerouteNodes.back()->EndReroute = NewReroute;
+		}
+
+		RestoredConnection->RerouteNodes.push_back(NewReroute);
+	}
+
+	if (!RestoredConnection->RerouteNodes.empty())
+		RestoredConnection->RerouteNodes.back()->EndSocket = Record.InSocket;
+}
+
+void NodeArea::RestoreRerouteNode(const TransactionRecord& Record)
+{
+	// Connection that was removed later in transaction restores its reroute nodes itself.
+	Connection* ParentConnection = GetConnection(Record.OutSocket, Record.InSocket);
+	if (ParentConnection == nullptr)
+		return;
+
+	RerouteNode* NewReroute = CreateRerouteNode(ParentConnection);
+	NewReroute->ID = Record.RerouteNodeIDs[0];
+	NewReroute->Position = Record.RerouteNodePositions[0];
+
+	std::vector<RerouteNode*>& RerouteNodes = ParentConnection->RerouteNodes;
+	RerouteNodes.insert(RerouteNodes.begin() + std::min(Record.RerouteNodeIndex, RerouteNodes.size()), NewReroute);
+
+	// Links of whole chain are set again, restored node could be first, last or in the middle.
+	for (size_t i = 0; i < RerouteNodes.size(); i++)
+	{
+		RerouteNodes[i]->BeginSocket = i == 0 ? Record.OutSocket : nullptr;
+		RerouteNodes[i]->BeginReroute = i == 0 ? nullptr : RerouteNodes[i - 1];
+		RerouteNodes[i]->EndSocket = i + 1 == RerouteNodes.size() ? Record.InSocket : nullptr;
+		RerouteNodes[i]->EndReroute = i + 1 == RerouteNodes.size() ? nullptr : RerouteNodes[i + 1];
+	}
+}
+
+bool NodeArea::CommitTransaction()
+{
+	if (!bTransactionActive)
+		return false;
+
+	bTransactionActive = false;
+	std::vector<TransactionRecord> Log;
+	Log.swap(TransactionLog);
+
+	// Postponed socket events are delivered in original order, but only to nodes that are still in area.
+	NodeAreaChangeSet ChangeSet;
+	for (size_t i = 0; i < Log.size(); i++)
+	{
+		const TransactionRecord& Record = Log[i];
+		if (Record.Type == TRANSACTION_NODE_ADDED)
+		{
+			ChangeSet.AddedNodes.push_back(Record.TargetNode);
+		}
+		else if (Record.Type == TRANSACTION_NODE_REMOVED)
+		{
+			ChangeSet.RemovedNodes.push_back(Record.TargetNode);
+		}
+		else if (Record.Type == TRANSACTION_CONNECTION_ADDED)
+		{
+			ChangeSet.AddedConnections.push_back(std::make_pair(Record.OutSocket, Record.InSocket));
+
+			if (ContainsNode(Record.OutSocket->GetParent()))
+				Record.OutSocket->GetParent()->SocketEvent(Record.OutSocket, Record.InSocket, CONNECTED);
+			if (ContainsNode(Record.InSocket->GetParent()))
+				Record.InSocket->GetParent()->SocketEvent(Record.InSocket, Record.OutSocket, CONNECTED);
+		}
+		else if (Record.Type == TRANSACTION_CONNECTION_REMOVED)
+		{
+			ChangeSet.RemovedConnections.push_back(std::make_pair(Record.OutSocket, Record.InSocket));
+
+			if (ContainsNode(Record.InSocket->GetParent()))
+				Record.InSocket->GetParent()->SocketEvent(Record.InSocket, Record.OutSocket, DISCONNECTED);
+		}
+	}
+
+	if (!ChangeSet.IsEmpty())
+	{
+		for (size_t i = 0; i < ChangeSetCallbacks.size(); i++)
+			ChangeSetCallbacks[i](ChangeSet);
+	}
+
+	for (size_t i = 0; i < ChangeSet.RemovedNodes.size(); i++)
+		CancelAsync(ChangeSet.RemovedNodes[i]);
+
+	RemoveSocketEventsOfDetachedNodes();
+	for (size_t i = 0; i < ChangeSet.RemovedNodes.size(); i++)
+		DestroyNode(ChangeSet.RemovedNodes[i]);
+
+	return true;
+}
+
+bool NodeArea::AbortTransaction()
+{
+	if (!bTransactionActive)
+		return false;
+
+	bTransactionActive = false;
+	std::vector<TransactionRecord> Log;
+	Log.swap(TransactionLog);
+
+	// Undo in reverse order, so every record sees area in the same state as when it was made.
+	std::vector<Node*> NodesToDestroy;
+	for (size_t i = Log.size(); i > 0; i--)
+	{
+		const TransactionRecord& Record = Log[i - 1];
+		if (Record.Type == TRANSACTION_NODE_ADDED)
+		{
+			Node* NodeToRemove = Record.TargetNode;
+			if (!ContainsNode(NodeToRemove))
+				continue;
+
+			DetachNode(NodeToRemove);
+			NodesToDestroy.push_back(NodeToRemove);
+		}
+		else if (Record.Type == TRANSACTION_NODE_REMOVED)
+		{
+			AddNode(Record.TargetNode);
+			if (Record.bWasDirty)
+			{
+				Record.TargetNode->bDirty = true;
+				DirtyNodes.push_back(Record.TargetNode->AreaHandle);
+			}
+
+			// Restored node gets new handle, tasks that it started should still find it.
+			for (size_t j = 0; j < AsyncTasks.size(); j++)
+			{
+				if (AsyncTasks[j]->TargetNode == Record.TargetNode)
+					AsyncTasks[j]->NodeHandle = Record.TargetNode->AreaHandle;
+			}
+		}
+		else if (Record.Type == TRANSACTION_CONNECTION_ADDED)
+		{
+			Connection* ConnectionToRemove = GetConnection(Record.OutSocket, Record.InSocket);
+			if (ConnectionToRemove == nullptr)
+				continue;
+
+			UnSelect(ConnectionToRemove);
+			for (size_t j = 0; j < ConnectionToRemove->RerouteNodes.size(); j++)
+				UnSelect(ConnectionToRemove->RerouteNodes[j]);
+
+			RemoveSocketFromConnected(Record.OutSocket->ConnectedSockets, Record.InSocket);
+			RemoveSocketFromConnected(Record.InSocket->ConnectedSockets, Record.OutSocket);
+			DestroyConnection(ConnectionToRemove);
+		}
+		else if (Record.Type == TRANSACTION_CONNECTION_REMOVED)
+		{
+			RestoreConnection(Record);
+			// Topological order is not updated for restored connections, it is rebuilt when needed.
+			bTopologicalOrderDirty = true;
+		}
+		else if (Record.Type == TRANSACTION_REROUTE_REMOVED)
+		{
+			RestoreRerouteNode(Record);
+		}
+	}
+
+	RemoveSocketEventsOfDetachedNodes();
+	for (size_t i = 0; i < NodesToDestroy.size(); i++)
+		DestroyNode(NodesToDestroy[i]);
+
+	return true;
+}
+
+// Drops transaction without events, used when whole area is cleared.
+void NodeArea::DiscardTransaction()
+{
+	if (!bTransactionActive)
+		return;
+
+	bTransactionActive = false;
+	for (size_t i = 0; i < TransactionLog.size(); i++)
+	{
+		if (TransactionLog[i].Type == TRANSACTION_NODE_REMOVED)
+			CancelAsync(TransactionLog[i].TargetNode);
+	}
+
+	RemoveSocketEventsOfDetachedNodes();
+	for (size_t i = 0; i < TransactionLog.size(); i++)
+	{
+		if (TransactionLog[i].Type == TRANSACTION_NODE_REMOVED)
+			DestroyNode(TransactionLog[i].TargetNode);
+	}
+
+	TransactionLog.clear();
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "VisualNodeArea.h"
+using namespace VisNodeSys;
+
+namespace
+{
+	// Buffers are kept per thread and per nesting level, so traversal does not allocate once they are warmed up
+	// and a callback could start another traversal.
+	struct TraversalScratch
+	{
+		std::vector<uint64_t> VisitedBits;
+		std::vector<uint32_t> VisitedIndices;
+		std::vector<Node*> Pending;
+	};
+
+	thread_local std::vector<std::unique_ptr<TraversalScratch>> ScratchStack;
+	thread_local size_t ScratchDepth = 0;
+
+	bool IsVisited(const std::vector<uint64_t>& Bits, const uint32_t Index)
+	{
+		return (Bits[Index >> 6] >> (Index & 63)) & 1u;
+	}
+
+	void MarkVisited(std::vector<uint64_t>& Bits, const uint32_t Index)
+	{
+		Bits[Index >> 6] |= uint64_t(1) << (Index & 63);
+	}
+}
+
+bool NodeArea::TraverseNodesInternal(Node* StartNode, const NODE_TRAVERSAL_DIRECTION Direction, const NODE_TRAVERSAL_ORDER Order, bool(*Visit)(void*, Node*), void* Context)
+{
+	if (StartNode == nullptr || Visit == nullptr || Nodes.Get(StartNode->AreaHandle) != StartNode)
+		return true;
+
+	if (ScratchDepth == ScratchStack.size())
+		ScratchStack.push_back(std::unique_ptr<TraversalScratch>(new TraversalScratch()));
+	TraversalScratch& Scratch = *ScratchStack[ScratchDepth];
+	ScratchDepth++;
+
+	const size_t WordCount = (Nodes.size() + 63) / 64;
+	if (Scratch.VisitedBits.size() < WordCount)
+		Scratch.VisitedBits.resize(WordCount, 0);
+
+	const bool bDownstream = Direction == TRAVERSE_DOWNSTREAM || Direction == TRAVERSE_BOTH;
+	const bool bUpstream = Direction == TRAVERSE_UPSTREAM || Direction == TRAVERSE_BOTH;
+
+	// Breadth first marks nodes when they are queued, depth first when they are taken from stack.
+	// That way both visit each node once, and depth first keeps preorder.
+	size_t QueueHead = 0;
+	Scratch.Pending.push_back(StartNode);
+	if (Order == BREADTH_FIRST)
+	{
+		const uint32_t StartIndex = static_cast<uint32_t>(Nodes.GetElementIndex(StartNode->AreaHandle));
+		MarkVisited(Scratch.VisitedBits, StartIndex);
+		Scratch.VisitedIndices.push_back(StartIndex);
+	}
+
+	bool bCompleted = true;
+	while (Order == BREADTH_FIRST ? QueueHead < Scratch.Pending.size() : !Scratch.Pending.empty())
+	{
+		Node* CurrentNode = nullptr;
+		if (Order == BREADTH_FIRST)
+		{
+			CurrentNode = Scratch.Pending[QueueHead++];
+		}
+		else
+		{
+			CurrentNode = Scratch.Pending.back();
+			Scratch.Pending.pop_back();
+
+			const uint32_t CurrentIndex = static_cast<uint32_t>(Nodes.GetElementIndex(CurrentNode->AreaHandle));
+			if (IsVisited(Scratch.VisitedBits, CurrentIndex))
+				continue;
+
+			MarkVisited(Scratch.VisitedBits, CurrentIndex);
+			Scratch.VisitedIndices.push_back(CurrentIndex);
+		}
+
+		if (!Visit(Context, CurrentNode))
+		{
+			bCompleted = false;
+			break;
+		}
+
+		for (size_t Pass = 0; Pass < 2; Pass++)
+		{
+			if ((Pass == 0 && !bDownstream) || (Pass == 1 && !bUpstream))
+				continue;
+
+			const std::vector<NodeSocket*>& Sockets = Pass == 0 ? CurrentNode->Output : CurrentNode->Input;
+			for (size_t i = 0; i < Sockets.size(); i++)
+			{
+				const std::vector<NodeSocket*>& ConnectedSockets = Sockets[i]->ConnectedSockets;
+				for (size_t j = 0; j < ConnectedSockets.size(); j++)
+				{
+					Node* ConnectedNode = ConnectedSockets[j]->Parent;
+					const uint32_t ConnectedIndex = static_cast<uint32_t>(Nodes.GetElementIndex(ConnectedNode->AreaHandle));
+					if (IsVisited(Scratch.VisitedBits, ConnectedIndex))
+						continue;
+
+					if (Order == DEPTH_FIRST)
+					{
+						Scratch.Pending.push_back(ConnectedNode);
+						continue;
+					}
+
+					MarkVisited(Scratch.VisitedBits, ConnectedIndex);
+					Scratch.VisitedIndices.push_back(ConnectedIndex);
+					Scratch.Pending.push_back(ConnectedNode);
+				}
+			}
+		}
+	}
+
+	// Only bits that were set are cleared, cost is proportional to visited part of graph.
+	for (size_t i = 0; i < Scratch.VisitedIndices.size(); i++)
+		Scratch.VisitedBits[Scratch.VisitedIndices[i] >> 6] = 0;
+	Scratch.VisitedIndices.clear();
+	Scratch.Pending.clear();
+	ScratchDepth--;
+
+	return bCompleted;
+}
\ No newline at end of file
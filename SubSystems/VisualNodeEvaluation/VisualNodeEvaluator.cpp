@@ -0,0 +1,185 @@
+#include "VisualNodeEvaluator.h"
+using namespace VisNodeSys;
+
+NodeEvaluator::NodeEvaluator(NodeArea* Area, ThreadPool* Pool) : Area(Area), Pool(Pool), RemainingNodeCount(0), ExecutedNodeCount(0) {}
+
+size_t NodeEvaluator::GetExecutedNodeCount() const
+{
+	return ExecutedNodeCount.load();
+}
+
+void NodeEvaluator::BuildDependencies()
+{
+	const size_t NodeCount = Area->Nodes.size();
+	EvaluatedNodes.assign(Area->Nodes.begin(), Area->Nodes.end());
+	FirstDependent.assign(NodeCount + 1, 0);
+	DependencyCount.assign(NodeCount, 0);
+
+	// Every connection is one dependency, so node waits for each of its connections separately.
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		const Node* CurrentNode = EvaluatedNodes[i];
+		for (size_t j = 0; j < CurrentNode->Output.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+			{
+				const Node* ConnectedNode = ConnectedSockets[k]->GetParent();
+				if (!Area->ContainsNode(ConnectedNode))
+					continue;
+
+				FirstDependent[i + 1]++;
+				DependencyCount[Area->Nodes.GetElementIndex(ConnectedNode->AreaHandle)]++;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < NodeCount; i++)
+		FirstDependent[i + 1] += FirstDependent[i];
+
+	DependentNodes.resize(FirstDependent[NodeCount]);
+	for (size_t i = 0; i < NodeCount; i++)
+	{
+		const Node* CurrentNode = EvaluatedNodes[i];
+		uint32_t Position = FirstDependent[i];
+		for (size_t j = 0; j < CurrentNode->Output.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+			{
+				const Node* ConnectedNode = ConnectedSockets[k]->GetParent();
+				if (Area->ContainsNode(ConnectedNode))
+					DependentNodes[Position++] = static_cast<uint32_t>(Area->Nodes.GetElementIndex(ConnectedNode->AreaHandle));
+			}
+		}
+	}
+
+	if (RemainingDependenciesCapacity < NodeCount)
+	{
+		RemainingDependencies.reset(new std::atomic<uint32_t>[NodeCount]);
+		RemainingDependenciesCapacity = NodeCount;
+	}
+
+	for (size_t i = 0; i < NodeCount; i++)
+		RemainingDependencies[i].store(DependencyCount[i], std::memory_order_relaxed);
+
+	CountExecutableNodes();
+}
+
+// Nodes on cycles never get all their dependencies, so evaluation should not wait for them.
+void NodeEvaluator::CountExecutableNodes()
+{
+	ExecutableNodeCount = EvaluatedNodes.size();
+	if (!Area->HasCycles())
+		return;
+
+	std::vector<uint32_t> Remaining = DependencyCount;
+	std::vector<uint32_t> Ready;
+	for (size_t i = 0; i < Remaining.size(); i++)
+	{
+		if (Remaining[i] == 0)
+			Ready.push_back(static_cast<uint32_t>(i));
+	}
+
+	for (size_t i = 0; i < Ready.size(); i++)
+	{
+		for (uint32_t j = FirstDependent[Ready[i]]; j < FirstDependent[Ready[i] + 1]; j++)
+		{
+			Remaining[DependentNodes[j]]--;
+			if (Remaining[DependentNodes[j]] == 0)
+				Ready.push_back(DependentNodes[j]);
+		}
+	}
+
+	ExecutableNodeCount = Ready.size();
+}
+
+void NodeEvaluator::RunTask(void* Context, void* Data)
+{
+	static_cast<NodeEvaluator*>(Context)->Execute(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(Data)));
+}
+
+void NodeEvaluator::Schedule(const uint32_t NodeIndex)
+{
+	if (Pool != nullptr && Pool->GetWorkerCount() > 0 && EvaluatedNodes[NodeIndex]->IsThreadSafe())
+	{
+		ThreadPoolTask Task;
+		Task.Run = RunTask;
+		Task.Context = this;
+		Task.Data = reinterpret_cast<void*>(static_cast<uintptr_t>(NodeIndex));
+		Pool->Submit(Task);
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(CallerQueueMutex);
+	CallerQueue.push_back(NodeIndex);
+	CallerWakeUp.notify_one();
+}
+
+void NodeEvaluator::Execute(const uint32_t NodeIndex)
+{
+	EvaluatedNodes[NodeIndex]->SocketEvent(nullptr, nullptr, EXECUTE);
+	ExecutedNodeCount++;
+
+	for (uint32_t i = FirstDependent[NodeIndex]; i < FirstDependent[NodeIndex + 1]; i++)
+	{
+		if (RemainingDependencies[DependentNodes[i]].fetch_sub(1, std::memory_order_acq_rel) == 1)
+			Schedule(DependentNodes[i]);
+	}
+
+	// Evaluate could return as soon as bFinished is set, so evaluator should not be touched after that.
+	if (RemainingNodeCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		std::lock_guard<std::mutex> Lock(CallerQueueMutex);
+		bFinished = true;
+		CallerWakeUp.notify_one();
+	}
+}
+
+bool NodeEvaluator::Evaluate()
+{
+	if (Area == nullptr)
+		return false;
+
+	BuildDependencies();
+	ExecutedNodeCount = 0;
+	if (ExecutableNodeCount == 0)
+		return EvaluatedNodes.empty();
+
+	RemainingNodeCount = ExecutableNodeCount;
+	bFinished = false;
+	CallerQueue.clear();
+
+	for (size_t i = 0; i < EvaluatedNodes.size(); i++)
+	{
+		if (DependencyCount[i] == 0)
+			Schedule(static_cast<uint32_t>(i));
+	}
+
+	while (true)
+	{
+		std::unique_lock<std::mutex> Lock(CallerQueueMutex);
+		if (!CallerQueue.empty())
+		{
+			const uint32_t NodeIndex = CallerQueue.back();
+			CallerQueue.pop_back();
+			Lock.unlock();
+
+			Execute(NodeIndex);
+			continue;
+		}
+
+		if (bFinished)
+			break;
+
+		Lock.unlock();
+		// Calling thread helps workers while it has nothing of its own to do.
+		if (Pool != nullptr && Pool->TryRunTask())
+			continue;
+
+		Lock.lock();
+		CallerWakeUp.wait(Lock, [this]() { return bFinished || !CallerQueue.empty(); });
+	}
+
+	return ExecutedNodeCount.load() == EvaluatedNodes.size();
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../VisualNodeArea/VisualNodeArea.h"
+#include "VisualNodeThreadPool.h"
+
+namespace VisNodeSys
+{
+	// Executes every node of area once, each node only after all nodes connected to its inputs.
+	// Node is executed with SocketEvent(nullptr, nullptr, EXECUTE), as TriggerOrphanSocketEvent does.
+	// Thread safe nodes (Node::IsThreadSafe) run concurrently on pool workers,
+	// other nodes run one at a time on thread that called Evaluate.
+	// Area should not be modified while evaluation is running.
+	class NodeEvaluator
+	{
+		NodeArea* Area = nullptr;
+		ThreadPool* Pool = nullptr;
+
+		// Nodes that depend on node i are DependentNodes[FirstDependent[i]] .. DependentNodes[FirstDependent[i + 1] - 1].
+		std::vector<Node*> EvaluatedNodes;
+		std::vector<uint32_t> FirstDependent;
+		std::vector<uint32_t> DependentNodes;
+		std::vector<uint32_t> DependencyCount;
+		std::unique_ptr<std::atomic<uint32_t>[]> RemainingDependencies;
+		size_t RemainingDependenciesCapacity = 0;
+		size_t ExecutableNodeCount = 0;
+
+		std::atomic<size_t> RemainingNodeCount;
+		std::atomic<size_t> ExecutedNodeCount;
+
+		// Nodes that should be executed on thread that called Evaluate.
+		std::mutex CallerQueueMutex;
+		std::condition_variable CallerWakeUp;
+		std::vector<uint32_t> CallerQueue;
+		bool bFinished = false;
+
+		void BuildDependencies();
+		void CountExecutableNodes();
+		void Schedule(uint32_t NodeIndex);
+		void Execute(uint32_t NodeIndex);
+		static void RunTask(void* Context, void* Data);
+	public:
+		// Without pool, or with pool that has no workers, all nodes run on calling thread.
+		NodeEvaluator(NodeArea* Area, ThreadPool* Pool = nullptr);
+		NodeEvaluator(const NodeEvaluator&) = delete;
+		NodeEvaluator& operator=(const NodeEvaluator&) = delete;
+
+		// Returns false if some nodes were not executed because they are on cycle or depend on one.
+		bool Evaluate();
+		size_t GetExecutedNodeCount() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,554 @@
+#include "VisualNodeExecutionPlan.h"
+using namespace VisNodeSys;
+
+NodeExecutionPlan::NodeExecutionPlan(NodeArea* Area) : Area(Area) {}
+
+bool NodeExecutionPlan::IsUpToDate() const
+{
+	return bCompiled && Area != nullptr && CompiledTopologyVersion == Area->GetTopologyVersion();
+}
+
+void NodeExecutionPlan::SetTargets(const std::vector<NodeSocket*>& TargetSockets)
+{
+	Targets.clear();
+	for (size_t i = 0; i < TargetSockets.size(); i++)
+	{
+		if (TargetSockets[i] == nullptr || TargetSockets[i]->GetParent() == nullptr)
+			continue;
+
+		Target NewTarget;
+		NewTarget.NodeID = TargetSockets[i]->GetParent()->GetID();
+		NewTarget.SocketID = TargetSockets[i]->GetID();
+		Targets.push_back(NewTarget);
+	}
+
+	bCompiled = false;
+}
+
+void NodeExecutionPlan::ClearTargets()
+{
+	Targets.clear();
+	bCompiled = false;
+}
+
+bool NodeExecutionPlan::HasTargets() const
+{
+	return !Targets.empty();
+}
+
+bool NodeExecutionPlan::IsReusingLaneBuffers() const
+{
+	return bReuseLaneBuffers;
+}
+
+void NodeExecutionPlan::SetReusingLaneBuffers(const bool NewValue)
+{
+	bReuseLaneBuffers = NewValue;
+	// Sharing of lanes depends only on steps, so compiled plan does not need to be compiled again.
+	if (bCompiled)
+		PlanLaneBuffers();
+}
+
+size_t NodeExecutionPlan::GetLaneMemorySize(const size_t LaneCount) const
+{
+	size_t Result = 0;
+	for (size_t i = 0; i < OutputSlots.size(); i++)
+	{
+		if (OutputSlots[i] != nullptr && LaneBufferOwners[i] == i)
+			Result += OutputSlots[i]->ValueSize * LaneCount;
+	}
+
+	return Result;
+}
+
+bool NodeExecutionPlan::IsOptimizing() const
+{
+	return bOptimize;
+}
+
+void NodeExecutionPlan::SetOptimizing(const bool NewValue)
+{
+	bOptimize = NewValue;
+	bCompiled = false;
+}
+
+const NodeExecutionPlanReport& NodeExecutionPlan::GetOptimizationReport() const
+{
+	return OptimizationReport;
+}
+
+const std::vector<NodeExecutionStep>& NodeExecutionPlan::GetSteps() const
+{
+	return Steps;
+}
+
+const void* NodeExecutionPlan::GetInputValue(const size_t StepIndex, const size_t InputIndex) const
+{
+	if (StepIndex >= Steps.size() || InputIndex >= Steps[StepIndex].InputCount)
+		return nullptr;
+
+	return InputValues[Steps[StepIndex].FirstInput + InputIndex];
+}
+
+void* NodeExecutionPlan::GetOutputValue(const size_t StepIndex, const size_t OutputIndex) const
+{
+	if (StepIndex >= Steps.size() || OutputIndex >= Steps[StepIndex].OutputCount)
+		return nullptr;
+
+	return OutputValues[Steps[StepIndex].FirstOutput + OutputIndex];
+}
+
+void* NodeExecutionPlan::GetOutputLanes(const size_t StepIndex, const size_t OutputIndex) const
+{
+	if (StepIndex >= Steps.size() || OutputIndex >= Steps[StepIndex].OutputCount || OutputLanes.empty())
+		return nullptr;
+
+	return OutputLanes[Steps[StepIndex].FirstOutput + OutputIndex];
+}
+
+bool NodeExecutionPlan::Compile()
+{
+	bCompiled = false;
+	Steps.clear();
+	InputValues.clear();
+	OutputValues.clear();
+	WrittenSlots.clear();
+	FirstWrittenSlot.clear();
+	InputSlots.clear();
+	OutputSlots.clear();
+	InputLanes.clear();
+	OutputLanes.clear();
+	InputSources.clear();
+	LaneBufferOwners.clear();
+	OptimizationReport = NodeExecutionPlanReport();
+
+	if (Area == nullptr)
+		return false;
+
+	std::vector<Node*> Order;
+	std::vector<Node*> ObservedNodes;
+	if (Targets.empty())
+	{
+		Order = Area->GetTopologicalOrder();
+		if (Order.empty() && Area->GetNodeCount() > 0)
+			return false;
+	}
+	else if (!CollectTargetCone(Order, ObservedNodes))
+	{
+		return false;
+	}
+
+	// Outputs are added in order of steps, so output connected to input is already known when input is resolved.
+	std::unordered_map<const SocketDataSlotBase*, uint32_t> SlotOutputs;
+	Steps.reserve(Order.size());
+	FirstWrittenSlot.reserve(Order.size() + 1);
+	for (size_t i = 0; i < Order.size(); i++)
+	{
+		Node* CurrentNode = Order[i];
+		NodeExecutionStep Step;
+		Step.TargetNode = CurrentNode;
+		Step.Function = CurrentNode->ExecuteFunction;
+		Step.BatchFunction = CurrentNode->BatchExecuteFunction;
+
+		// Input with several connections is resolved to the first one.
+		Step.FirstInput = static_cast<uint32_t>(InputValues.size());
+		Step.InputCount = static_cast<uint32_t>(CurrentNode->Input.size());
+		for (size_t j = 0; j < CurrentNode->Input.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[j]->ConnectedSockets;
+			SocketDataSlotBase* Slot = nullptr;
+			if (!ConnectedSockets.empty())
+				Slot = ConnectedSockets[0]->DataSlot.get();
+
+			InputValues.push_back(Slot == nullptr ? nullptr : Slot->GetValue());
+			InputSlots.push_back(Slot);
+
+			const auto Iterator = Slot == nullptr ? SlotOutputs.end() : SlotOutputs.find(Slot);
+			InputSources.push_back(Iterator == SlotOutputs.end() ? UINT32_MAX : Iterator->second);
+		}
+
+		Step.FirstOutput = static_cast<uint32_t>(OutputValues.size());
+		Step.OutputCount = static_cast<uint32_t>(CurrentNode->Output.size());
+		FirstWrittenSlot.push_back(static_cast<uint32_t>(WrittenSlots.size()));
+		for (size_t j = 0; j < CurrentNode->Output.size(); j++)
+		{
+			SocketDataSlotBase* Slot = CurrentNode->Output[j]->DataSlot.get();
+			OutputValues.push_back(Slot == nullptr ? nullptr : Slot->GetValue());
+			OutputSlots.push_back(Slot);
+			if (Slot != nullptr)
+				SlotOutputs[Slot] = static_cast<uint32_t>(OutputSlots.size() - 1);
+			if (Slot != nullptr && Step.Function != nullptr)
+				WrittenSlots.push_back(Slot);
+		}
+
+		Steps.push_back(Step);
+	}
+	FirstWrittenSlot.push_back(static_cast<uint32_t>(WrittenSlots.size()));
+	if (bOptimize)
+		Optimize(ObservedNodes);
+	PlanLaneBuffers();
+
+	CompiledTopologyVersion = Area->GetTopologyVersion();
+	bCompiled = true;
+	return true;
+}
+
+bool NodeExecutionPlan::Execute()
+{
+	if (!IsUpToDate() && !Compile())
+		return false;
+
+	const uint64_t Revision = NodeSocket::DataRevision.load();
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (!Steps[i].bFolded && !Steps[i].bEliminated)
+			ExecuteStep(i, Revision);
+	}
+
+	return true;
+}
+
+void NodeExecutionPlan::ExecuteStep(const size_t StepIndex, const uint64_t Revision)
+{
+	const NodeExecutionStep& Step = Steps[StepIndex];
+	if (Step.Function == nullptr)
+	{
+		Step.TargetNode->SocketEvent(nullptr, nullptr, EXECUTE);
+		return;
+	}
+
+	Step.Function(Step.TargetNode, InputValues.data() + Step.FirstInput, OutputValues.data() + Step.FirstOutput);
+
+	// Written values are current, so GetData on these sockets would not compute them again.
+	for (uint32_t j = FirstWrittenSlot[StepIndex]; j < FirstWrittenSlot[StepIndex + 1]; j++)
+	{
+		WrittenSlots[j]->bDirty = false;
+		WrittenSlots[j]->ChangedAt = Revision;
+		WrittenSlots[j]->VerifiedAt = Revision;
+	}
+}
+
+// Constness flows downstream and observation upstream, so one pass over steps in each direction is enough.
+// Every connection of input is followed, not only the first one, because nodes without execute function could read all of them.
+void NodeExecutionPlan::Optimize(const std::vector<Node*>& ObservedNodes)
+{
+	std::unordered_map<const Node*, uint32_t> NodeSteps;
+	for (size_t i = 0; i < Steps.size(); i++)
+		NodeSteps[Steps[i].TargetNode] = static_cast<uint32_t>(i);
+
+	std::vector<char> Constant(Steps.size(), 0);
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		const Node* CurrentNode = Steps[i].TargetNode;
+		if (!CurrentNode->bPure)
+			continue;
+
+		bool bConstant = true;
+		for (size_t j = 0; j < CurrentNode->Input.size() && bConstant; j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size() && bConstant; k++)
+			{
+				const auto Iterator = NodeSteps.find(ConnectedSockets[k]->GetParent());
+				bConstant = Iterator != NodeSteps.end() && Constant[Iterator->second];
+			}
+		}
+
+		Constant[i] = bConstant;
+	}
+
+	std::vector<char> Observed(Steps.size(), 0);
+	for (size_t i = 0; i < Steps.size(); i++)
+		Observed[i] = !Steps[i].TargetNode->bPure;
+
+	// Without targets sinks are observed, that is nodes with no consumer in plan.
+	for (size_t i = 0; i < Steps.size() && Targets.empty(); i++)
+	{
+		const Node* CurrentNode = Steps[i].TargetNode;
+		bool bHasConsumer = false;
+		for (size_t j = 0; j < CurrentNode->Output.size() && !bHasConsumer; j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Output[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size() && !bHasConsumer; k++)
+				bHasConsumer = NodeSteps.count(ConnectedSockets[k]->GetParent()) > 0;
+		}
+
+		if (!bHasConsumer)
+			Observed[i] = 1;
+	}
+
+	for (size_t i = 0; i < ObservedNodes.size(); i++)
+	{
+		const auto Iterator = NodeSteps.find(ObservedNodes[i]);
+		if (Iterator != NodeSteps.end())
+			Observed[Iterator->second] = 1;
+	}
+
+	for (size_t i = Steps.size(); i-- > 0;)
+	{
+		if (!Observed[i])
+			continue;
+
+		const Node* CurrentNode = Steps[i].TargetNode;
+		for (size_t j = 0; j < CurrentNode->Input.size(); j++)
+		{
+			const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[j]->ConnectedSockets;
+			for (size_t k = 0; k < ConnectedSockets.size(); k++)
+			{
+				const auto Iterator = NodeSteps.find(ConnectedSockets[k]->GetParent());
+				if (Iterator != NodeSteps.end())
+					Observed[Iterator->second] = 1;
+			}
+		}
+	}
+
+	const uint64_t Revision = NodeSocket::DataRevision.load();
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (!Observed[i])
+		{
+			Steps[i].bEliminated = true;
+			OptimizationReport.EliminatedNodeIDs.push_back(Steps[i].TargetNode->GetID());
+		}
+		else if (Constant[i])
+		{
+			ExecuteStep(i, Revision);
+			Steps[i].bFolded = true;
+			OptimizationReport.FoldedNodeIDs.push_back(Steps[i].TargetNode->GetID());
+		}
+	}
+}
+
+bool NodeExecutionPlan::ExecuteBatch(const size_t FirstInstance, const size_t LaneCount)
+{
+	if (!IsUpToDate() && !Compile())
+		return false;
+
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (!Steps[i].bEliminated && Steps[i].BatchFunction == nullptr && Steps[i].Function == nullptr)
+			return false;
+	}
+
+	// Lanes of every slot are resolved before any node runs, so that growing one of them could not move arrays already in use.
+	OutputLanes.resize(OutputSlots.size());
+	for (size_t i = 0; i < OutputSlots.size(); i++)
+		OutputLanes[i] = OutputSlots[i] == nullptr || LaneBufferOwners[i] == UINT32_MAX ? nullptr : OutputSlots[LaneBufferOwners[i]]->GetLanes(LaneCount);
+
+	InputLanes.resize(InputSlots.size());
+	for (size_t i = 0; i < InputSlots.size(); i++)
+	{
+		if (InputSources[i] != UINT32_MAX)
+			InputLanes[i] = OutputLanes[InputSources[i]];
+		else
+			InputLanes[i] = InputSlots[i] == nullptr ? nullptr : InputSlots[i]->GetLanes(LaneCount);
+	}
+
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		const NodeExecutionStep& Step = Steps[i];
+		if (Step.bEliminated)
+			continue;
+
+		if (Step.BatchFunction != nullptr)
+		{
+			Step.BatchFunction(Step.TargetNode, InputLanes.data() + Step.FirstInput, OutputLanes.data() + Step.FirstOutput, FirstInstance, LaneCount);
+			continue;
+		}
+
+		LaneInputs.resize(Step.InputCount);
+		LaneOutputs.resize(Step.OutputCount);
+		for (size_t Lane = 0; Lane < LaneCount; Lane++)
+		{
+			for (uint32_t j = 0; j < Step.InputCount; j++)
+			{
+				const uint32_t Index = Step.FirstInput + j;
+				LaneInputs[j] = InputLanes[Index] == nullptr ? nullptr : static_cast<const char*>(InputLanes[Index]) + Lane * InputSlots[Index]->ValueSize;
+			}
+
+			for (uint32_t j = 0; j < Step.OutputCount; j++)
+			{
+				const uint32_t Index = Step.FirstOutput + j;
+				LaneOutputs[j] = OutputLanes[Index] == nullptr ? nullptr : static_cast<char*>(OutputLanes[Index]) + Lane * OutputSlots[Index]->ValueSize;
+			}
+
+			Step.Function(Step.TargetNode, LaneInputs.data(), LaneOutputs.data());
+		}
+	}
+
+	return true;
+}
+
+// Linear scan over steps: outputs of step take free arrays first, arrays of outputs whose last reader is this step are freed after it.
+// Outputs of step are assigned before its inputs are freed, so node never writes into array that it reads.
+void NodeExecutionPlan::PlanLaneBuffers()
+{
+	LaneBufferOwners.resize(OutputSlots.size());
+	for (size_t i = 0; i < LaneBufferOwners.size(); i++)
+		LaneBufferOwners[i] = static_cast<uint32_t>(i);
+
+	// Eliminated steps do not need lanes.
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (!Steps[i].bEliminated)
+			continue;
+
+		for (uint32_t j = Steps[i].FirstOutput; j < Steps[i].FirstOutput + Steps[i].OutputCount; j++)
+			LaneBufferOwners[j] = UINT32_MAX;
+	}
+
+	if (!bReuseLaneBuffers)
+		return;
+
+	std::vector<uint32_t> LastReader(OutputSlots.size(), UINT32_MAX);
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		if (Steps[i].bEliminated)
+			continue;
+
+		for (uint32_t j = Steps[i].FirstInput; j < Steps[i].FirstInput + Steps[i].InputCount; j++)
+		{
+			if (InputSources[j] != UINT32_MAX)
+				LastReader[InputSources[j]] = static_cast<uint32_t>(i);
+		}
+	}
+
+	std::vector<uint32_t> FreeOwners;
+	for (size_t i = 0; i < Steps.size(); i++)
+	{
+		const NodeExecutionStep& Step = Steps[i];
+		if (Step.bEliminated)
+			continue;
+
+		for (uint32_t j = Step.FirstOutput; j < Step.FirstOutput + Step.OutputCount; j++)
+		{
+			if (OutputSlots[j] == nullptr || LastReader[j] == UINT32_MAX)
+				continue;
+
+			for (size_t k = 0; k < FreeOwners.size(); k++)
+			{
+				if (OutputSlots[FreeOwners[k]]->TypeTag != OutputSlots[j]->TypeTag)
+					continue;
+
+				LaneBufferOwners[j] = FreeOwners[k];
+				FreeOwners[k] = FreeOwners.back();
+				FreeOwners.pop_back();
+				break;
+			}
+		}
+
+		for (uint32_t j = Step.FirstInput; j < Step.FirstInput + Step.InputCount; j++)
+		{
+			const uint32_t Source = InputSources[j];
+			if (Source == UINT32_MAX || LastReader[Source] != i)
+				continue;
+
+			FreeOwners.push_back(LaneBufferOwners[Source]);
+			// Input could be connected to the same output more than once.
+			LastReader[Source] = UINT32_MAX - 1;
+		}
+	}
+}
+
+// Depth first search upstream from targets, node is added after all of its inputs were visited.
+// Order of area is not used, so cycles outside of cone do not matter.
+bool NodeExecutionPlan::CollectTargetCone(std::vector<Node*>& Order, std::vector<Node*>& ObservedNodes) const
+{
+	// 1 - node is on current path, 2 - node is already in Order.
+	std::unordered_map<const Node*, uint8_t> State;
+	// Node and index of its next input connection to visit, inputs are numbered across all input sockets.
+	std::vector<std::pair<Node*, size_t>> Path;
+
+	const auto Visit = [&](Node* StartNode) {
+		if (StartNode == nullptr || StartNode->GetParentArea() != Area || State.count(StartNode))
+			return true;
+
+		State[StartNode] = 1;
+		Path.push_back(std::make_pair(StartNode, size_t(0)));
+		while (!Path.empty())
+		{
+			Node* CurrentNode = Path.back().first;
+			Node* NextNode = nullptr;
+			size_t& ConnectionIndex = Path.back().second;
+			size_t Skipped = 0;
+			for (size_t i = 0; i < CurrentNode->Input.size() && NextNode == nullptr; i++)
+			{
+				const std::vector<NodeSocket*>& ConnectedSockets = CurrentNode->Input[i]->ConnectedSockets;
+				if (ConnectionIndex >= Skipped + ConnectedSockets.size())
+				{
+					Skipped += ConnectedSockets.size();
+					continue;
+				}
+
+				NextNode = ConnectedSockets[ConnectionIndex - Skipped]->GetParent();
+				ConnectionIndex++;
+			}
+
+			if (NextNode == nullptr)
+			{
+				State[CurrentNode] = 2;
+				Order.push_back(CurrentNode);
+				Path.pop_back();
+				continue;
+			}
+
+			if (NextNode->GetParentArea() != Area)
+				continue;
+
+			const auto Iterator = State.find(NextNode);
+			if (Iterator != State.end())
+			{
+				if (Iterator->second == 1)
+					return false;
+
+				continue;
+			}
+
+			State[NextNode] = 1;
+			Path.push_back(std::make_pair(NextNode, size_t(0)));
+		}
+
+		return true;
+	};
+
+	for (size_t i = 0; i < Targets.size(); i++)
+	{
+		Node* TargetNode = Area->GetNodeByID(Targets[i].NodeID);
+		if (TargetNode == nullptr)
+			continue;
+
+		NodeSocket* TargetSocket = nullptr;
+		for (size_t j = 0; j < TargetNode->Input.size() && TargetSocket == nullptr; j++)
+		{
+			if (TargetNode->Input[j]->GetID() == Targets[i].SocketID)
+				TargetSocket = TargetNode->Input[j];
+		}
+
+		for (size_t j = 0; j < TargetNode->Output.size() && TargetSocket == nullptr; j++)
+		{
+			if (TargetNode->Output[j]->GetID() == Targets[i].SocketID)
+				TargetSocket = TargetNode->Output[j];
+		}
+
+		if (TargetSocket == nullptr)
+			continue;
+
+		if (TargetSocket->isOutput())
+		{
+			ObservedNodes.push_back(TargetNode);
+			if (!Visit(TargetNode))
+				return false;
+
+			continue;
+		}
+
+		for (size_t j = 0; j < TargetSocket->ConnectedSockets.size(); j++)
+		{
+			ObservedNodes.push_back(TargetSocket->ConnectedSockets[j]->GetParent());
+			if (!Visit(TargetSocket->ConnectedSockets[j]->GetParent()))
+				return false;
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../VisualNodeArea/VisualNodeArea.h"
+
+namespace VisNodeSys
+{
+	// One node of compiled plan, its inputs and outputs are ranges in InputValues and OutputValues of plan.
+	struct NodeExecutionStep
+	{
+		Node* TargetNode = nullptr;
+		NodeExecuteFunction Function = nullptr;
+		NodeBatchExecuteFunction BatchFunction = nullptr;
+		uint32_t FirstInput = 0;
+		uint32_t InputCount = 0;
+		uint32_t FirstOutput = 0;
+		uint32_t OutputCount = 0;
+		// Set by optimization, folded step was executed once by Compile, eliminated step is never executed.
+		bool bFolded = false;
+		bool bEliminated = false;
+	};
+
+	// Nodes that optimization of NodeExecutionPlan folded into constants or eliminated, in order of steps.
+	struct NodeExecutionPlanReport
+	{
+		std::vector<std::string> FoldedNodeIDs;
+		std::vector<std::string> EliminatedNodeIDs;
+	};
+
+	// Flattened NodeArea for repeated evaluation.
+	// Compile resolves nodes in topological order and pointers to values of connected typed outputs once,
+	// Execute then only walks steps, without socket event queue or data function lookups.
+	// Nodes with NodeExecuteFunction are called through it and their typed outputs are marked as computed,
+	// other nodes get SocketEvent(nullptr, nullptr, EXECUTE).
+	// Plan is compiled again when topology version of area changes,
+	// after data or execute functions of nodes are replaced Compile should be called explicitly.
+	// With target sockets plan contains only nodes that these sockets depend on, other nodes are not executed.
+	class NodeExecutionPlan
+	{
+		NodeArea* Area = nullptr;
+		uint64_t CompiledTopologyVersion = 0;
+		bool bCompiled = false;
+		bool bReuseLaneBuffers = false;
+		bool bOptimize = false;
+		NodeExecutionPlanReport OptimizationReport;
+
+		// Targets are kept by IDs, so that deleted nodes would not leave dangling pointers.
+		struct Target
+		{
+			std::string NodeID;
+			std::string SocketID;
+		};
+		std::vector<Target> Targets;
+
+		std::vector<NodeExecutionStep> Steps;
+		std::vector<const void*> InputValues;
+		std::vector<void*> OutputValues;
+		// Slots of outputs that are written by execute functions.
+		std::vector<SocketDataSlotBase*> WrittenSlots;
+		std::vector<uint32_t> FirstWrittenSlot;
+
+		// Slots behind InputValues and OutputValues, and arrays of their lanes from last ExecuteBatch.
+		std::vector<SocketDataSlotBase*> InputSlots;
+		std::vector<SocketDataSlotBase*> OutputSlots;
+		std::vector<const void*> InputLanes;
+		std::vector<void*> OutputLanes;
+		// Pointers to single lane, for nodes that are executed lane by lane.
+		std::vector<const void*> LaneInputs;
+		std::vector<void*> LaneOutputs;
+		// Index of output that is connected to input, UINT32_MAX if it is not part of plan.
+		std::vector<uint32_t> InputSources;
+		// Index of output whose slot holds lanes of output i.
+		std::vector<uint32_t> LaneBufferOwners;
+
+		// Nodes that targets depend on, each after nodes connected to its inputs. Returns false on cycle.
+		// ObservedNodes gets nodes whose outputs are read by targets.
+		bool CollectTargetCone(std::vector<Node*>& Order, std::vector<Node*>& ObservedNodes) const;
+		void Optimize(const std::vector<Node*>& ObservedNodes);
+		void ExecuteStep(size_t StepIndex, uint64_t Revision);
+		// Assigns lanes of outputs to slots, with reuse output gets lanes of earlier output of the same type
+		// whose last reader already ran. Outputs without readers in plan keep their own lanes.
+		void PlanLaneBuffers();
+	public:
+		NodeExecutionPlan(NodeArea* Area);
+
+		// Returns false if area contains cycles.
+		bool Compile();
+		bool IsUpToDate() const;
+
+		// Target output needs its node and everything upstream of it,
+		// target input needs nodes connected to it and everything upstream of them.
+		// Targets that are no longer in area are skipped, empty targets mean whole area.
+		void SetTargets(const std::vector<NodeSocket*>& TargetSockets);
+		void ClearTargets();
+		bool HasTargets() const;
+
+		// Compiles plan first if topology changed. Returns false if plan could not be compiled.
+		bool Execute();
+
+		const std::vector<NodeExecutionStep>& GetSteps() const;
+		// Value of output connected to input socket InputIndex of step, nullptr if there is none.
+		const void* GetInputValue(size_t StepIndex, size_t InputIndex) const;
+		void* GetOutputValue(size_t StepIndex, size_t OutputIndex) const;
+
+		// Constant folding and dead node elimination, they apply only to pure nodes.
+		// Pure node is constant if every node connected to its inputs is constant, node without inputs included,
+		// it is executed once by Compile and then its outputs are kept. After values of such nodes change Compile should be called.
+		// Node is observed if it is not pure, if target reads its outputs, or, when plan has no targets, if no node of plan consumes its outputs.
+		// Pure node without path to observed node is skipped.
+		// ExecuteBatch skips eliminated nodes but executes folded ones, because their lanes are needed.
+		bool IsOptimizing() const;
+		void SetOptimizing(bool NewValue);
+		const NodeExecutionPlanReport& GetOptimizationReport() const;
+
+		// Runs plan once for LaneCount instances, values of typed outputs are arrays of LaneCount values.
+		// Nodes without batch function are executed lane by lane with their execute function,
+		// returns false without executing anything if some node has neither of them.
+		// Cached values of sockets are not changed.
+		bool ExecuteBatch(size_t FirstInstance, size_t LaneCount);
+		// Lanes written to output OutputIndex of step by last ExecuteBatch, nullptr if output does not have typed data.
+		// With reuse, lanes of outputs that are read by other steps could be overwritten later in the same batch.
+		void* GetOutputLanes(size_t StepIndex, size_t OutputIndex) const;
+
+		// Intermediate lanes share arrays once their last reader ran, so peak memory follows live outputs instead of all of them.
+		bool IsReusingLaneBuffers() const;
+		void SetReusingLaneBuffers(bool NewValue);
+		// Bytes of lane arrays that ExecuteBatch with LaneCount lanes uses.
+		size_t GetLaneMemorySize(size_t LaneCount) const;
+	};
+}
\ No newline at end of file
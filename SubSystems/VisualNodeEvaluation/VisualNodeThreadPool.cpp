@@ -0,0 +1,140 @@
+#include "VisualNodeThreadPool.h"
+using namespace VisNodeSys;
+
+namespace
+{
+	thread_local const ThreadPool* CurrentPool = nullptr;
+	thread_local size_t CurrentWorkerIndex = 0;
+}
+
+ThreadPool::ThreadPool(const size_t WorkerCount) : PendingTaskCount(0), SleepingWorkerCount(0)
+{
+	// Last queue is shared one, for tasks submitted from outside of pool.
+	for (size_t i = 0; i < WorkerCount + 1; i++)
+		Queues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+
+	for (size_t i = 0; i < WorkerCount; i++)
+		Workers.push_back(std::thread(&ThreadPool::WorkerLoop, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		bStopping = true;
+	}
+	WakeUp.notify_all();
+
+	for (size_t i = 0; i < Workers.size(); i++)
+		Workers[i].join();
+
+	// Tasks that were never started are run here, so that they could release what they own.
+	while (TryRunTask()) {}
+}
+
+size_t ThreadPool::GetWorkerCount() const
+{
+	return Workers.size();
+}
+
+int ThreadPool::GetCurrentWorkerIndex() const
+{
+	if (CurrentPool != this)
+		return -1;
+
+	return static_cast<int>(CurrentWorkerIndex);
+}
+
+void ThreadPool::Submit(const ThreadPoolTask& Task)
+{
+	if (Task.Run == nullptr)
+		return;
+
+	const int WorkerIndex = GetCurrentWorkerIndex();
+	TaskQueue& Queue = WorkerIndex == -1 ? *Queues.back() : *Queues[WorkerIndex];
+	// Counted before push, so that counter never goes below zero when task is taken right away.
+	PendingTaskCount++;
+	{
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		Queue.Tasks.push_back(Task);
+	}
+
+	// Sleeping worker registers itself under SleepMutex before it checks PendingTaskCount,
+	// so either it sees new task or we see it and wake it up.
+	if (SleepingWorkerCount.load() > 0)
+	{
+		std::lock_guard<std::mutex> Lock(SleepMutex);
+		WakeUp.notify_one();
+	}
+}
+
+bool ThreadPool::TryPopOwn(const size_t QueueIndex, ThreadPoolTask& Task)
+{
+	TaskQueue& Queue = *Queues[QueueIndex];
+	std::lock_guard<std::mutex> Lock(Queue.Mutex);
+	if (Queue.Tasks.empty())
+		return false;
+
+	Task = Queue.Tasks.back();
+	Queue.Tasks.pop_back();
+	PendingTaskCount--;
+	return true;
+}
+
+bool ThreadPool::TrySteal(const size_t FirstQueueIndex, ThreadPoolTask& Task)
+{
+	for (size_t i = 0; i < Queues.size(); i++)
+	{
+		TaskQueue& Queue = *Queues[(FirstQueueIndex + i) % Queues.size()];
+		std::lock_guard<std::mutex> Lock(Queue.Mutex);
+		if (Queue.Tasks.empty())
+			continue;
+
+		Task = Queue.Tasks.front();
+		Queue.Tasks.pop_front();
+		PendingTaskCount--;
+		return true;
+	}
+
+	return false;
+}
+
+bool ThreadPool::TryRunTask()
+{
+	if (PendingTaskCount.load() == 0)
+		return false;
+
+	ThreadPoolTask Task;
+	const int WorkerIndex = GetCurrentWorkerIndex();
+	if (WorkerIndex != -1 && TryPopOwn(WorkerIndex, Task))
+	{
+		Task.Run(Task.Context, Task.Data);
+		return true;
+	}
+
+	if (!TrySteal(WorkerIndex == -1 ? Queues.size() - 1 : WorkerIndex + 1, Task))
+		return false;
+
+	Task.Run(Task.Context, Task.Data);
+	return true;
+}
+
+void ThreadPool::WorkerLoop(const size_t WorkerIndex)
+{
+	CurrentPool = this;
+	CurrentWorkerIndex = WorkerIndex;
+
+	while (true)
+	{
+		if (TryRunTask())
+			continue;
+
+		std::unique_lock<std::mutex> Lock(SleepMutex);
+		SleepingWorkerCount++;
+		WakeUp.wait(Lock, [this]() { return bStopping || PendingTaskCount.load() > 0; });
+		SleepingWorkerCount--;
+
+		if (bStopping)
+			return;
+	}
+}
\ No newline at end of file
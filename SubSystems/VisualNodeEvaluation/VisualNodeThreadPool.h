@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VisNodeSys
+{
+	// Type erased task, so that submitting does not allocate.
+	struct ThreadPoolTask
+	{
+		void(*Run)(void* Context, void* Data) = nullptr;
+		void* Context = nullptr;
+		void* Data = nullptr;
+	};
+
+	// Every worker owns a deque: it takes its own tasks from the back, idle workers steal from the front of others.
+	// Tasks submitted from worker go to its own deque, tasks submitted from other threads go to shared one.
+	// With zero workers tasks are only run by threads that call TryRunTask.
+	// Tasks that are still pending when pool is destroyed are run by destroying thread.
+	class ThreadPool
+	{
+		struct TaskQueue
+		{
+			std::mutex Mutex;
+			std::deque<ThreadPoolTask> Tasks;
+		};
+
+		std::vector<std::unique_ptr<TaskQueue>> Queues;
+		std::vector<std::thread> Workers;
+
+		std::atomic<size_t> PendingTaskCount;
+		std::atomic<size_t> SleepingWorkerCount;
+		std::mutex SleepMutex;
+		std::condition_variable WakeUp;
+		bool bStopping = false;
+
+		bool TryPopOwn(size_t QueueIndex, ThreadPoolTask& Task);
+		bool TrySteal(size_t FirstQueueIndex, ThreadPoolTask& Task);
+		void WorkerLoop(size_t WorkerIndex);
+	public:
+		explicit ThreadPool(size_t WorkerCount);
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		~ThreadPool();
+
+		size_t GetWorkerCount() const;
+		void Submit(const ThreadPoolTask& Task);
+
+		// Runs one pending task on calling thread, returns false if there was none.
+		bool TryRunTask();
+
+		// Returns index of worker that is calling it or -1 if it is not worker of this pool.
+		int GetCurrentWorkerIndex() const;
+	};
+}
\ No newline at end of file
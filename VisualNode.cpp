@@ -1,4 +1,4 @@
-#include "VisualNode.h"
+#include "SubSystems/VisualNodeArea/VisualNodeArea.h"
 using namespace VisNodeSys;
 
 Node::Node(const std::string ID)
@@ -26,6 +26,11 @@ Node::Node(const Node& Src)
 	Type = Src.Type;
 	Style = Src.Style;
 	bShouldBeDestroyed = false;
+	bThreadSafe = Src.bThreadSafe;
+	bPure = Src.bPure;
+	EventPriority = Src.EventPriority;
+	ExecuteFunction = Src.ExecuteFunction;
+	BatchExecuteFunction = Src.BatchExecuteFunction;
 
 	LeftTop = Src.LeftTop;
 	RightBottom = Src.RightBottom;
@@ -41,24 +46,20 @@ Node::Node(const Node& Src)
 	for (size_t i = 0; i < Src.Output.size(); i++)
 	{
 		Output.push_back(new NodeSocket(this, Src.Output[i]->GetType(), Src.Output[i]->GetName(), true, Src.Output[i]->OutputData));
+		if (Src.Output[i]->DataSlot != nullptr)
+			Output.back()->DataSlot.reset(Src.Output[i]->DataSlot->Clone());
 	}
 }
 
 Node::~Node()
 {
-	for (int i = 0; i < static_cast<int>(Input.size()); i++)
-	{
+	for (size_t i = 0; i < Input.size(); i++)
 		delete Input[i];
-		Input.erase(Input.begin() + i, Input.begin() + i + 1);
-		i--;
-	}
+	Input.clear();
 
-	for (int i = 0; i < static_cast<int>(Output.size()); i++)
-	{
+	for (size_t i = 0; i < Output.size(); i++)
 		delete Output[i];
-		Output.erase(Output.begin() + i, Output.begin() + i + 1);
-		i--;
-	}
+	Output.clear();
 }
 
 std::string Node::GetID()
@@ -74,6 +75,7 @@ ImVec2 Node::GetPosition() const
 void Node::SetPosition(const ImVec2 NewValue)
 {
 	Position = NewValue;
+	UpdateGeometryInArea();
 }
 
 ImVec2 Node::GetSize() const
@@ -87,6 +89,7 @@ ImVec2 Node::GetSize() const
 void Node::SetSize(const ImVec2 NewValue)
 {
 	Size = NewValue;
+	UpdateGeometryInArea();
 }
 
 std::string Node::GetName()
@@ -188,6 +191,7 @@ void Node::FromJson(Json::Value Json)
 	Position.y = Json["position"]["y"].asFloat();
 	Size.x = Json["size"]["x"].asFloat();
 	Size.y = Json["size"]["y"].asFloat();
+	UpdateGeometryInArea();
 	Name = Json["name"].asCString();
 
 	const std::vector<Json::String> InputsList = Json["input"].getMemberNames();
@@ -236,6 +240,9 @@ void Node::FromJson(Json::Value Json)
 void Node::UpdateClientRegion()
 {
 	float LongestInputSocketTextW = 0.0f;
+	float LongestOutputSocketTextW = 0.0f;
+	// Without Dear ImGui there is no font to measure socket names with.
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	for (size_t i = 0; i < Input.size(); i++)
 	{
 		const ImVec2 TextSize = ImGui::CalcTextSize(Input[i]->GetName().c_str());
@@ -243,13 +250,13 @@ void Node::UpdateClientRegion()
 			LongestInputSocketTextW = TextSize.x;
 	}
 
-	float LongestOutputSocketTextW = 0.0f;
 	for (size_t i = 0; i < Output.size(); i++)
 	{
 		const ImVec2 TextSize = ImGui::CalcTextSize(Output[i]->GetName().c_str());
 		if (TextSize.x > LongestOutputSocketTextW)
 			LongestOutputSocketTextW = TextSize.x;
 	}
+#endif
 
 	ClientRegionMin.x = LeftTop.x + NODE_SOCKET_SIZE * 5.0f + LongestInputSocketTextW + 2.0f;
 	ClientRegionMax.x = RightBottom.x - NODE_SOCKET_SIZE * 5.0f - LongestOutputSocketTextW - 2.0f;
@@ -280,38 +287,49 @@ size_t Node::GetOutputSocketCount() const
 	return Output.size();
 }
 
-std::vector<Node*> Node::GetNodesConnectedToInput() const
+// Few connected nodes are deduplicated by searching result, many with hash set, so that wide fan-in stays linear.
+std::vector<Node*> Node::GetNodesConnectedTo(const std::vector<NodeSocket*>& Sockets)
 {
+	static const size_t MaxLinearSearchCount = 32;
+
+	size_t ConnectedSocketCount = 0;
+	for (size_t i = 0; i < Sockets.size(); i++)
+		ConnectedSocketCount += Sockets[i]->ConnectedSockets.size();
+
 	std::vector<Node*> Result;
-	for (size_t i = 0; i < Input.size(); i++)
+	Result.reserve(ConnectedSocketCount);
+	std::unordered_set<const Node*> AddedNodes;
+	const bool bUseSet = ConnectedSocketCount > MaxLinearSearchCount;
+	for (size_t i = 0; i < Sockets.size(); i++)
 	{
-		for (size_t j = 0; j < Input[i]->ConnectedSockets.size(); j++)
+		for (size_t j = 0; j < Sockets[i]->ConnectedSockets.size(); j++)
 		{
-			if (IsNodeWithIDInList(Input[i]->ConnectedSockets[j]->GetParent()->GetID(), Result))
+			Node* ConnectedNode = Sockets[i]->ConnectedSockets[j]->GetParent();
+			if (bUseSet)
+			{
+				if (!AddedNodes.insert(ConnectedNode).second)
+					continue;
+			}
+			else if (std::find(Result.begin(), Result.end(), ConnectedNode) != Result.end())
+			{
 				continue;
+			}
 
-			Result.push_back(Input[i]->ConnectedSockets[j]->GetParent());
+			Result.push_back(ConnectedNode);
 		}
 	}
 
 	return Result;
 }
 
-std::vector<Node*> Node::GetNodesConnectedToOutput() const
+std::vector<Node*> Node::GetNodesConnectedToInput() const
 {
-	std::vector<Node*> Result;
-	for (size_t i = 0; i < Output.size(); i++)
-	{
-		for (size_t j = 0; j < Output[i]->ConnectedSockets.size(); j++)
-		{
-			if (IsNodeWithIDInList(Output[i]->ConnectedSockets[j]->GetParent()->GetID(), Result))
-				continue;
-
-			Result.push_back(Output[i]->ConnectedSockets[j]->GetParent());
-		}
-	}
+	return GetNodesConnectedTo(Input);
+}
 
-	return Result;
+std::vector<Node*> Node::GetNodesConnectedToOutput() const
+{
+	return GetNodesConnectedTo(Output);
 }
 
 bool Node::OpenContextMenu()
@@ -330,6 +348,7 @@ void Node::SetStyle(const NODE_STYLE NewValue)
 		return;
 
 	Style = NewValue;
+	UpdateGeometryInArea();
 }
 
 bool Node::IsHovered() const
@@ -340,6 +359,7 @@ bool Node::IsHovered() const
 void Node::SetIsHovered(const bool NewValue)
 {
 	bHovered = NewValue;
+	UpdateGeometryInArea();
 }
 
 bool Node::CouldBeMoved() const
@@ -350,6 +370,13 @@ bool Node::CouldBeMoved() const
 void Node::SetCouldBeMoved(bool NewValue)
 {
 	bCouldBeMoved = NewValue;
+	UpdateGeometryInArea();
+}
+
+void Node::UpdateGeometryInArea()
+{
+	if (ParentArea != nullptr)
+		ParentArea->UpdateNodeGeometry(this);
 }
 
 NodeArea* Node::GetParentArea() const
@@ -362,7 +389,76 @@ bool Node::CouldBeDestroyed() const
 	return bShouldBeDestroyed;
 }
 
-bool Node::IsNodeWithIDInList(const std::string ID, const std::vector<Node*> List)
+bool Node::IsBusy() const
+{
+	return AsyncTaskCount > 0;
+}
+
+bool Node::RunAsync(std::function<void(const std::atomic<bool>& bCancelled)> Work, std::function<void()> Completion)
+{
+	if (ParentArea == nullptr)
+		return false;
+
+	return ParentArea->RunAsync(this, std::move(Work), std::move(Completion));
+}
+
+int Node::GetEventPriority() const
+{
+	return EventPriority;
+}
+
+void Node::SetEventPriority(const int NewValue)
+{
+	EventPriority = NewValue;
+}
+
+bool Node::IsThreadSafe() const
+{
+	return bThreadSafe;
+}
+
+void Node::SetIsThreadSafe(const bool NewValue)
+{
+	bThreadSafe = NewValue;
+}
+
+bool Node::IsPure() const
+{
+	return bPure;
+}
+
+void Node::SetIsPure(const bool NewValue)
+{
+	bPure = NewValue;
+}
+
+void Node::InvalidateOutputData()
+{
+	for (size_t i = 0; i < Output.size(); i++)
+		Output[i]->InvalidateData();
+}
+
+NodeExecuteFunction Node::GetExecuteFunction() const
+{
+	return ExecuteFunction;
+}
+
+void Node::SetExecuteFunction(const NodeExecuteFunction NewValue)
+{
+	ExecuteFunction = NewValue;
+}
+
+NodeBatchExecuteFunction Node::GetBatchExecuteFunction() const
+{
+	return BatchExecuteFunction;
+}
+
+void Node::SetBatchExecuteFunction(const NodeBatchExecuteFunction NewValue)
+{
+	BatchExecuteFunction = NewValue;
+}
+
+bool Node::IsNodeWithIDInList(const std::string& ID, const std::vector<Node*>& List)
 {
 	for (size_t i = 0; i < List.size(); i++)
 	{
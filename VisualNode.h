@@ -23,15 +23,31 @@ namespace VisNodeSys
 		EXECUTE = 4
 	};
 
+	// Called by NodeExecutionPlan instead of SocketEvent(nullptr, nullptr, EXECUTE).
+	// Inputs[i] points to value of output connected to input socket i, Outputs[i] to value of output socket i.
+	// Pointer is nullptr if socket is not connected or output does not have typed data.
+	typedef void(*NodeExecuteFunction)(Node* Node, const void* const* Inputs, void* const* Outputs);
+	// Called by NodeExecutionPlan::ExecuteBatch, Inputs[i] and Outputs[i] point to arrays of LaneCount values.
+	// Lane j holds value of instance FirstInstance + j.
+	typedef void(*NodeBatchExecuteFunction)(Node* Node, const void* const* Inputs, void* const* Outputs, size_t FirstInstance, size_t LaneCount);
+
 	class Node
 	{
 	protected:
 		friend class NodeSystem;
 		friend class NodeArea;
+		friend class NodeEvaluator;
+		friend class NodeSocket;
+		friend class NodeExecutionPlan;
 
 		virtual ~Node();
 
 		NodeArea* ParentArea = nullptr;
+		SlotHandle AreaHandle;
+		uint32_t TopologicalIndex = UINT32_MAX;
+		bool bDirty = false;
+		// Number of tasks that NodeArea::RunAsync started for this node and did not deliver yet.
+		int AsyncTaskCount = 0;
 		std::string ID;
 		ImVec2 Position;
 		ImVec2 Size;
@@ -44,6 +60,14 @@ namespace VisNodeSys
 		bool bShouldBeDestroyed = false;
 		bool bCouldBeDestroyed = true;
 		bool bCouldBeMoved = true;
+		// Thread safe node could be executed on worker thread, concurrently with other nodes.
+		bool bThreadSafe = false;
+		// Pure node computes outputs only from its inputs and has no side effects.
+		bool bPure = false;
+		// Socket events of nodes with higher priority are delivered first when NodeArea schedules them.
+		int EventPriority = 0;
+		NodeExecuteFunction ExecuteFunction = nullptr;
+		NodeBatchExecuteFunction BatchExecuteFunction = nullptr;
 
 		std::vector<NodeSocket*> Input;
 		std::vector<NodeSocket*> Output;
@@ -57,6 +81,9 @@ namespace VisNodeSys
 		bool bHovered = false;
 		void SetIsHovered(bool NewValue);
 
+		// Should be called after Position, Size or Style was changed directly.
+		void UpdateGeometryInArea();
+
 		NODE_STYLE Style = DEFAULT;
 
 		virtual void Draw();
@@ -66,7 +93,11 @@ namespace VisNodeSys
 
 		void UpdateClientRegion();
 
-		static bool IsNodeWithIDInList(std::string ID, std::vector<Node*> List);
+		// For SocketEvent that does slow work, see NodeArea::RunAsync.
+		bool RunAsync(std::function<void(const std::atomic<bool>& bCancelled)> Work, std::function<void()> Completion = nullptr);
+
+		static bool IsNodeWithIDInList(const std::string& ID, const std::vector<Node*>& List);
+		static std::vector<Node*> GetNodesConnectedTo(const std::vector<NodeSocket*>& Sockets);
 	public:
 		Node(std::string ID = "");
 		Node(const Node& Src);
@@ -108,6 +139,30 @@ namespace VisNodeSys
 
 		bool CouldBeDestroyed() const;
 
+		// True while node has asynchronous work that is not delivered yet.
+		bool IsBusy() const;
+
+		int GetEventPriority() const;
+		void SetEventPriority(int NewValue);
+
+		bool IsThreadSafe() const;
+		void SetIsThreadSafe(bool NewValue);
+
+		// Optimizing NodeExecutionPlan evaluates pure nodes with constant inputs only once
+		// and skips pure nodes whose outputs do not reach any observed node.
+		bool IsPure() const;
+		void SetIsPure(bool NewValue);
+
+		// Cached values of all output sockets would be computed again on next request.
+		void InvalidateOutputData();
+
+		NodeExecuteFunction GetExecuteFunction() const;
+		void SetExecuteFunction(NodeExecuteFunction NewValue);
+
+		// Without batch function ExecuteBatch calls ExecuteFunction once for every lane.
+		NodeBatchExecuteFunction GetBatchExecuteFunction() const;
+		void SetBatchExecuteFunction(NodeBatchExecuteFunction NewValue);
+
 		NodeArea* GetParentArea() const;
 	};
 }
\ No newline at end of file
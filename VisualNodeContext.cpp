@@ -0,0 +1,50 @@
+#include "VisualNodeContext.h"
+using namespace VisNodeSys;
+
+NodeContext::NodeContext() : RandomEngine(std::random_device{}()) {}
+
+NodeContext::NodeContext(NodeFactory* ExternalFactory) : Factory(ExternalFactory), RandomEngine(std::random_device{}()) {}
+
+NodeContext& NodeContext::GetDefault()
+{
+	static NodeContext DefaultContext(&NODE_FACTORY);
+	return DefaultContext;
+}
+
+NodeFactory& NodeContext::GetFactory()
+{
+	return *Factory;
+}
+
+std::string NodeContext::GetUniqueHexID()
+{
+	return NODE_CORE.GetUniqueHexID(RandomEngine);
+}
+
+void NodeContext::AssociateSocketTypeToColor(std::string SocketType, ImColor Color)
+{
+	SocketTypeToColorAssosiations[SocketType] = Color;
+}
+
+std::vector<std::pair<std::string, ImColor>> NodeContext::GetAssociationsOfSocketTypeToColor() const
+{
+	std::vector<std::pair<std::string, ImColor>> Result;
+	auto iterator = SocketTypeToColorAssosiations.begin();
+	while (iterator != SocketTypeToColorAssosiations.end())
+	{
+		Result.push_back(std::make_pair(iterator->first, iterator->second));
+		iterator++;
+	}
+
+	return Result;
+}
+
+bool NodeContext::GetSocketTypeColor(const std::string& SocketType, ImColor& Color) const
+{
+	auto iterator = SocketTypeToColorAssosiations.find(SocketType);
+	if (iterator == SocketTypeToColorAssosiations.end())
+		return false;
+
+	Color = iterator->second;
+	return true;
+}
\ No newline at end of file
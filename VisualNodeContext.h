@@ -0,0 +1,32 @@
+#pragma once
+
+#include "VisualNodeFactory.h"
+
+namespace VisNodeSys
+{
+	// Owns state that would otherwise be global: node factory, socket type registry and ID generator.
+	// Node areas that use different contexts can be loaded, evaluated and saved on different threads concurrently.
+	// One context should not be used by multiple threads at the same time.
+	class NodeContext
+	{
+		NodeFactory OwnFactory;
+		NodeFactory* Factory = &OwnFactory;
+		std::unordered_map<std::string, ImColor> SocketTypeToColorAssosiations;
+		std::mt19937 RandomEngine;
+
+		NodeContext(NodeFactory* ExternalFactory);
+	public:
+		NodeContext();
+
+		// Context used by node areas that were created without explicit context.
+		// Its factory is NODE_FACTORY.
+		static NodeContext& GetDefault();
+
+		NodeFactory& GetFactory();
+		std::string GetUniqueHexID();
+
+		void AssociateSocketTypeToColor(std::string SocketType, ImColor Color);
+		std::vector<std::pair<std::string, ImColor>> GetAssociationsOfSocketTypeToColor() const;
+		bool GetSocketTypeColor(const std::string& SocketType, ImColor& Color) const;
+	};
+}
\ No newline at end of file
@@ -6,6 +6,7 @@ NodeCore* NodeCore::Instance = nullptr;
 NodeCore::NodeCore() {}
 NodeCore::~NodeCore() {}
 
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 const char* FontBase64Part_0 = R"(AAEAAAARAQAABAAQRFNJRwAAAAEAAKtEAAAACEZGVE1O5GfIAACrbAAAABxHREVGAQUABAAAq0wAAAAgT1MvMvkmnk8AAAGYAAAAYGNtYXBdCK2fAAADsAAAAnpjdnQgTRZetQAAEaAAAAI8ZnBnbXPTI7AAAAYsAAAHBWdhc3AAGAAJAACrNAAAABBnbHlmOVRdfwAAFZAAAIlEaGVhZPbdpYgAAAEcAAAANmhoZWELeAJiAAABVAAAACRobXR4TwpGygAAAfgAAAG4bG9jYWwaTdIAABPcAAABsm1heHAEfAJnAAABeAAAACBuYW1lEeU4+QAAntQAAAoycG9zdOx8/8cAAKkIAAACKnByZXDZmPeUAAANNAAABGoAAQAAAAEAAL0zFqVfDzz1AB8IAAAAAADJby3VAAAAAMlvLdX/9v45BNYGqAAAAAgAAgAAAAAAAAABAAAGqf2ZAAAEzf/2//cE1gABAAAAAAAAAAAAAAAAAAAABAABAAAA2AB5AAUAagAEAAIAEAAvAFoAAAMtAVIAAwABAAMEzQGQAAUACAWaBTMAAAEdBZoFMwAAA2EAZgISCAUCBwQJAgIFAgQEoAACr0AAePsAAAAAAAAAADFBU0MAQAAgIhkE5/5+AiYGqQJnYAAAn9/XAAAEOgVFAAAAIAABBM0ARAAAAAAEzQAABM0AAAIDARUANgBCAAAAKwH2AVYBUAD4AHQBAwFOAfAAcgB8AJQAkACAAGcAgACXAJ4AhQCNAfABYAB0AHQAdABeACwAAACiAHEAogCiAMIAcQCiAMoAsACiAO0AgQCiAGYAogBmAKIATwBMAI4ACgAAACQAJABJAZoAcwEOAIX/+wGSAIAAswCCAIoAhQCKAI8AuQCPAHUA7ACGAGMAswCCALMAigDyAKcAvgC5AEUAFQBeAEIAkwDjAhMApwBsAgMAhQA4AJ4ANAITAJ8BTwAfAM4AfwB0AB//+wFHAHQBOAEyAZIAkAB/AfAAdwEdAOIAawAbABEACwCZAAAAAAAAAAAAAAAAAAEAcQCiAKIAogCiAMoAygDKAMoAGwCiAGYAZgBmAGYAZgCdADgAjgCOAI4AjgAkAKIAjgCAAIAAgACAAIAAgAAUAIIAhQCFAIUAhQCPAI8AjwCPAH0AswCCAIIAggCCAIIAdABuALkAuQC5ALkAQgC5AEIAjwAUABwBGwF0AP8Aqv/2AY0BjwFdALEAsgCyAVABWgFuAMwAWwHwASUA+gDqAMUAAAADAAAAAwAAABwAAQAAAAABdAADAAEAAAAcAAQBWAAAACIAIAAEAAIAfgD/ATEBUwLGAtoC3CAUIBogHiAiIDogRCCsIhUiGf//AAAAIACgATEBUgLGAtoC3CATIBggHCAiIDkgRCCsIhUiGf///+MAAP+P/2/9/f3q/engs+Cw4K/grOCW4I3gJt683roAAQAAACAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAwBiAGMAZABlAGYAZwBoAGkAagBrAGwAbQAQAG4AbwBwAHEAcgBzAHQAdQB2AHcAeAB5AHoAewB8AH0AfgB/AIAAgQCCAIMAhACFAIYAhwCIAIkAigCLAIwAjQCOAI8AkACRAJIAkwCUAJUAlgCXAJgAmQCaAJsAnACdAJ4AnwCgAKEAogCjAKQApQCmAKcAqACpAKoAqwCsAK0ArgCvALAAsQCyALMAtAC1ALYAtwC4ALkAugC7ALwAvQC+AL8AAAEGAAABAAAAAAAAAAECAAAAAgAAAAAAAAAAAAAAAAAAAAEAAAMEBQYHCAkKCwwNDg8QERITFBUWFxgZGhscHR4fICEiIyQlJicoKSorLC0uLzAxMjM0NTY3ODk6Ozw9Pj9AQUJDREVGR0hJSktMTU5PUFFSU1RVVldYWVpbXF1eX2BhAISFh4mRlpyhoKKko6Wnqaiqq62srq+xs7K0trW6ubu8AHBjZGjOdp9uagB0aQCGmABxAABmdQAAAAAAa3oAprh/Ym0AAAAAbHsAA4CDlcHCxsfLzMjJtwC/ANHSz9AAAAB3ys0AgoqBi4iNjo+Mk5QAkpqbmcDDxW8AAMR4AAAAAABARVlYVVRTUlFQT05NTEtKSUhHRkVEQ0JBQD8+PTw7Ojk4NzY1MTAvLi0sKCcmJSQjIiEfGBQREA8ODQsKCQgHBgUEAwIBACxFI0ZgILAmYLAEJiNISC0sRSNGI2EgsCZhsAQmI0hILSxFI0ZgsCBhILBGYLAEJiNISC0sRSNGI2GwIGAgsCZhsCBhsAQmI0hILSxFI0ZgsEBhILBmYLAEJiNISC0sRSNGI2GwQGAgsCZhsEBhsAQmI0hILSwBECA8ADwtLCBFIyCwzUQjILgBWlFYIyCwjUQjWSCw7VFYIyCwTUQjWSCwBCZRWCMgsA1EI1khIS0sICBFGGhEILABYCBFsEZ2aIpFYEQtLAGxCwpDI0NlCi0sALEKC0MjQwstLACwKCNwsQEoPgGwKCNwsQIoRTqxAgAIDS0sIEWwAyVFYWSwUFFYRUQbISFZLSxJsA4jRC0sIEWwAENgRC0sAbAGQ7AHQ2UKLSwgabBAYbAAiyCxLMCKjLgQAGJgKwxkI2RhXFiwA2FZLSyKA0WKioewESuwKSNEsCl65BgtLEVlsCwjREWwKyNELSxLUlhFRBshIVktLEtRWEVEGyEhWS0sAbAFJRAjIIr1ALABYCPt7C0sAbAFJRAjIIr1ALABYSPt7C0sAbAGJRD1AO3sLSxGI0ZgiopGIyBGimCKYbj/gGIjIBAjirEMDIpwRWAgsABQWLABYbj/uosbsEaMWbAQYGgBOi0sIEWwAyVGUkuwE1FbWLACJUYgaGGwAyWwAyU/IyE4GyERWS0sIEWwAyVGUFiwAiVGIGhhsAMlsAMlPyMhOBshEVktLACwB0OwBkMLLSwhIQxkI2SLuEAAYi0sIbCAUVgMZCNki7ggAGIbsgBALytZsAJgLSwhsMBRWAxkI2SLuBVVYhuyAIAvK1mwAmAtLAxkI2SLuEAAYmAjIS0sS1NYirAEJUlkI0VpsECLYbCAYrAgYWqwDiNEIxCwDvYbISOKEhEgOS9ZLSxLU1ggsAMlSWRpILAFJrAGJUlkI2GwgGKwIGFqsA4jRLAEJhCwDvaKELAOI0SwDvawDiNEsA7tG4qwBCYREiA5IyA5Ly9ZLSxFI0VgI0VgI0VgI3ZoGLCAYiAtLLBIKy0sIEWwAFRYsEBEIEWwQGFEGyEhWS0sRbEwL0UjRWFgsAFgaUQtLEtRWLAvI3CwFCNCGyEhWS0sS1FYILADJUVpU1hEGyEhWRshIVktLEWwFEOwAGBjsAFgaUQtLLAvRUQtLEUjIEWKYEQtLEUjRWBELSxLI1FYuQAz/+CxNCAbszMANABZREQtLLAWQ1iwAyZFilhkZrAfYBtksCBgZiBYGyGwQFmwAWFZI1hlWbApI0QjELAp4BshISEhIVktLLACQ1RYS1MjS1FaWDgbISFZGyEhISFZLSywFkNYsAQlRWSwIGBmIFgbIbBAWbABYSNYG2VZsCkjRLAFJbAIJQggWAIbA1mwBCUQsAUlIEawBCUjQjywBCWwByUIsAclELAGJSBGsAQlsAFgI0I8IFgBGwBZsAQlELAFJbAp4LApIEVlRLAHJRCwBiWwKeCwBSWwCCUIIFgCGwNZsAUlsAMlQ0iwBCWwByUIsAYlsAMlsAFgQ0gbIVkhISEhISEhLSwCsAQlICBGsAQlI0KwBSUIsAMlRUghISEhLSwCsAMlILAEJQiwAiVDSCEhIS0sRSMgRRggsABQIFgjZSNZI2ggsEBQWCGwQFkjWGVZimBELSxLUyNLUVpYIEWKYEQbISFZLSxLVFggRYpgRBshIVktLEtTI0tRWlg4GyEhWS0ssAAhS1RYOBshIVktLLACQ1RYsEYrGyEhISFZLSywAkNUWLBHKxshISFZLSywAkNUWLBIKxshISEhWS0ssAJDVFiwSSsbISEhWS0sIIoII0tTiktRWlgjOBshIVktLACwAiVJsABTWCCwQDgRGyFZLSwBRiNGYCNGYSMgECBGimG4/4BiirFAQIpwRWBoOi0sIIojSWSKI1NYPBshWS0sS1JYfRt6WS0ssBIASwFLVEItLLECAEKxIwGIUbFAAYhTWli5EAAAIIhUWLICAQJDYEJZsSQBiFFYuSAAAECIVFiyAgICQ2BCsSQBiFRYsgIgAkNgQgBLAUtSWLICCAJDYEJZG7lAAACAiFRYsgIEAkNgQlm5QAAAgGO4AQCIVFiyAggCQ2BCWblAAAEAY7gCAIhUWLICEAJDYEJZuUAAAgBjuAQAiFRYsgJAAkNgQllZWVlZLSxFGGgjS1FYIyBFIGSwQFBYfFloimBZRC0ssAAWsAIlsAIlAbABIz4AsAIjPrEBAgYMsAojZUKwCyNCAbABIz8AsAIjP7EBAgYMsAYjZUKwByNCsAEWAS0seooQRSP1GC0AAABAZAkDBP0B9VAoH/JGKB/xRiof8EY1H4vum+6r7gNr74vvArvvAaTvARvvW+9r7wME7ETsAgrrRv8f5+QmH+bkPR/l5B4f4+JGHwviAUDiRhYf4eBGH7vgy+Db4ANA4DM2RuBGGB+8ARQAPgESAFUBE0AMPQNV3z3dVd493FW7QQkBFgABAFQBFgBkARYAAv/AARazDBZGILgBFrIBAgC8ARYAEAEWAAIBFbLcPR+4ARFAYwP/HxDdIN1A3VDdgN2w3QYg3FDcgNyw3AQP3AHQFTMfX8hvyH/IA1/Db8N/wwO/wgHBUCYfcL4BIL4wvsC+A3C+gL4CD7wfvAIvvD+8b7yvvN+8BbmtJh8guDC4ULhwuIC4Bbj/wEAcuBMpRhC3ASC3ULeAt7C3BIC1sLUCD7M/s++zA7gBDUArqkgfgLCQsAKwsMCw0LADL68/rwKgrbCtAsCt0K0CL6w/rAKfqwHAqtCqAkEPAQ8AMgEOAFUAAAEOABABDgAgAQ4AcAEOAAQADwEQQBUBUJxgnHCcA5mWJh+YRiYfMJdAlwK4/8CzlhYcRrj/wEAqlg4RRpUb/x8PlK+Uv5QDQJQdMUZAlBYbRkCUDA9GD5Mvkz+Tf5PvkwUPugEMAG8BDEAgApKNJh+RU/8f35ABMJABH5AvkAJvkH+QAgCPEI8gjwO4/8BAII8YHEYgjjCOAk+NX41vjQMwjAEPjB+ML4wDQIwQE0YQvwELACABCwAwAQsAA//AAQuyFyBGuf/AAQtAUBAURouCJh+JSjwfiIc9H4eEPB+GSv8fn4UBEIQghDCEAzCDAX+CAUCCCQxGc1AmH29GNR9uRjUfGgEYVRkzGFUHMwNVBgP/H2BQJh9fUCYfuf/gAQeyHyZGuf/gAQdAHxMcRl5aSB9cRjEfW1pIH1pGMR8TMhJVBQEDVQQyA1W4AQi1GzwfDwMBuQEZARiyNR9AuAEYshcoRrgBCkAlUCYfUlAbH+9R/1ECQFE1OEZAUSUoRs9QAd9MAUxGHR9LRkgfULgBG0BaAUpGJh9JRjUfSEY1H0dGNR+vRgHfRu9GAoBGARYyFVURAQ9VEDIPVQIBAFUBAAEfHw8/D18Pfw8EDw8vD08Pbw+PD98P/w8HPw9/D+8PA28AAU8AAaAWAQUBuAGQsVRTKytLuAf/UkuwCVBbsAGIsCVTsAGIsEBRWrAGiLAAVVpbWLEBAY5ZhY2NAEIdS7AyU1iwYB1ZS7BkU1iwQB1ZS7CAU1iwEB2xFgBCWXN0c3R1KysrKysBc3R1KysrK3MAKyt0dCsrcysrKytzKysrKwErKysAKysrKysrKysrASsrACsBK3N0dHMrKysrKysrcwArc3R0dCt1c3R0dCsrc3MrKytzKwErK3MrKwBzdHMrAXNzdABzdHRzdCtzAXMAc3QrcytzdAFzdHUAK3MBdAB0K3Nzcysrc19zK3R0KysrKwErK3QrK15zKwArKysBK15zAHNzc3RzASsrKwArcxhfXgAABcwFzAB9BUUAFQBgBUUAFQAAAAAAAAAAAAAAAAAABDoAFAB3AAD/7AAAAAD/7AAAAAD/7AAA/lcAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAIAAAAAAAAtAC9AKoAoADIALQAhQAAAAAAAACIAH4ApQDAAAAAAAAAAAAAAAAAAL8AyQCrAIwAvACbAI0AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAC5ALQAfAAAAAAAlABfAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABqABvAHgApADIAIMAjQC7AF4BigEDAGAAdACBALgAwABQBLEEw/5MAOsBsgDDAQkAewErApYAyQCWAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACSAKgAawCSALcAawCbAAAAAALyAJICPgBuAqUDRQCJAKAAYAJMAAAAwwAAAU4ApAFbAF4AgABpAG8AAABeAGgAAAAAAAAAAAAAAAAAJgNKAIcAewAAAHUAaAAAAAAAAAAAAAAFggIzAAv/9ACDAIkAjwCWAGkAcQBbAFIAAAAAAAAAsgIDAAAAjQMfALsArgC1AAAAAACLAAAAAAAAAAAGqQNwArwCCP2ZAJEAkQBNAE0AZABkAYEAnwCo/mj+nACbAUUBRQCQ/vYAFwB6BUUCTQAM/+4FmAKLAG4ATABiAEYA6ABEBREAAAAsACwALAAsAFQAfgEwAjADBgQIBCQEXASSBQwFSgV2BZIFrAXaBlwGqAciB+gIMgi8CWQJngpqCw4LNAtMC5wL1gwmDJwN3A4+DsIPVA+uD/IQLBCwEPQROhGEEewSDhKkEwYTeBPQFF4U2hWKFcIWGhZ+F3QX+BhaGKwY2BkIGTAZeBmMGaoaWBrWG1wb3hxoHMgddh3GHgYeWh7OHv4flB/qIE4g1iFcIbAiQiKaIvQjXiROJMolViWYJhgmMiayJxQnPifEKF4pKCmsKdQq3CsILAosnCzsLQ4t5C3uLk4uoi7+L4YvpDASMFQwXDCwMPAxTDGaMcAx3jIAMnoykjKqMsIy2jL0MwwzfDOQM6gzwDPYM/I0CjQiNDo0VDTQNOg1ADUYNTA1SDViNcw2ejaSNqo2wjbcNvQ3UjgKOCI4ODhSOHA4jDikOYQ5mDmwOcY53Dn0OhA6JjpEOmg7GjswO0g7Xjt0O4o7ojvuPKw8xDzaPPI9DD0iPaY9vj3uPmg/ID9IP8hAIEA0QEhAbkCYQMZBCkFWQaRB4EIOQjxCXkMAQyJDZEO8REpEogAAAAIARAAAAmQFVQADAAcALrEBAC88sgcEHO0ysQYF3DyyAwIc7TIAsQMALzyyBQQc7TKyBwYd/DyyAQIc7TIzESERJSERIUQCIP4kAZj+aAVV+qtEBM0AAAACAgMAAALJBUQAAwAHAClAFQMHmAIABBAEAgQECAkBAQIFnQQCAwA/L+0ROS8REgE5L10z7TIxMAEjAzMDNTMVArGUGMTGwgGNA7f6vMnJAAIBFQNNA7YFzAADAAcAJ0AUA5YCAgkHli8GAQAGAQYFAAAGAgAAPzMzLzIBL11d7RI5L+0xMAEjAzMBIwMzA4yOKOD+FY0p4ANNAn/9gQJ/AAAAAAIANgAABIsFRQAbAB8A8LkABP/wQJkNEUgGHRYdJh0DBgEWASYBAxIPDgsEChMIHRwVBBQJBAEAGQQYBRYfHgcEBhcTrBQFrAYXrBgaLwM/AwIDGgMYMAZABlAGAxAYIBgC4BjwGAIUBhgYBhQDCiEREQwMCawACgEKCAQMrw0dAQ0cABCvERkVEU8RAU8RXxHvEQMRQB8iSH8Njw2fDQNPDV8NAg0RDREFFxMDCgUALzM/MxI5OS8vXXErXXERMzMQ7TIyETMzEO0yMgEvXe0zLzMvERIXOS8vL11xcREzMy9dLxDtEO0Q7RESFzkREhc5ERIXORESFzkxMF1dKwEDIRUhAyMTIQMjEyM1MxMjNSETMwMhEzMDMxUhAyETA6JDAQT+5VhuVv6VVG5UyeFD8QEHWW5YAWtYbljT/UBFAWpDA0H+w2z+aAGY/mgBmGwBPWwBmP5oAZj+aGz+wwE9AAAAAwBC/3MEfgXEADkARABPARlAx0Q9VD0CZU4BbkcBZTwBai8BdSqFKgJ2KYYpAnYihiICZQ4BeQqJCgJ5CYkJAnkDiQMCeh+KHwIsby0tRUszJwY/JBEHBx91AIUAAgBvAEUQRSBFYEVwRQUQRSBFMEVwRZBFoEWwRQdFRVEMbwtAEiBIjgsBCws6bwAfQB8CAB8QH/AfAx8yQHMkShJzMz8/JC0tJyQlQCAnSCVAEhdIJSUkBksRcwgADBAMQAxQDGAMBUAMUAygDLAM8AwFDAwIkAcBBwcFCBgAPzMzL10RMy9dcRDtMj8zLysrETMzLxE5LzPtMhDtMgEvXXHtMy9dK+0RMy9dce1dEjkvMzMzzTIyMhEzL+1dMTAAXV1dXV1dXV1dXV0BXQEUDgIHFSM1LgEnNx4DFxEmJyYnJiMuBTU0PgI3NTMVHgMXBy4DJxEeBQEUHgIXEQ4DATQuAicRPgMEfjhyr3eA1/MiqgstTXBNCAcEBgMCMWJYTDgfQHKdXYBmkWZAFK4KJz9YOzpyZ1hBJPywKEVdNkdiPBsCpDBQajpBa00rAXxLgF85BaGhB7mnJTZbRCkEAekCAgECAQwdJzdJYT9Sd08oA4KCBCxQdUwhME85IQT+Vg4fKzpRbAI2NkcvHg4BnQMhNUX9Xj9RNCEP/ikEHjhSAAAFAAD/9ATOBVEAAwAXACsAPwBTAMG5AD7/2EAOCQ5IOCgJDEg0KAkMSC64/9izCQ5IFrj/2EAOCQ5IECgJDEgMKAkMSAa4/9hAFgkOSHkCiQICAgNWAHYAhgADAAEDEAG6//AAA//AQDoKDkgfAS8BPwEDAwEDARMxSrQ7tTG0cECAQAJAQBNVGLQJtSK0E0W2LLdPtjYZJ7YOtx22BAcCBgAYAD8/P+307T/t9O0BL+307RESOS9d/fTtERI5OS8vXSs4OBEzXREzXTEwACsrKysrKysrMyMBMyUyHgIVFA4CIyIuAjU0PgITNC4CIyIOAhUUHgIzMj4CATIeAhUUDgIjIi4CNTQ+AhM0LgIjIg4CFRQeAjMyPgLdkQOkk/ygOmdNLS1OaDw8aU4sLU5qxhIjMyEjNiQSEyQ1IiAzJBMCCDpnTS0tTmg8PGlOLC1OasYSIzMhIzYkEhMkNSIgMyQTBUkIH02BY2CCUCMjT4NgY4FNH/6wQlg1FRY1V0JAVzYXFzZX/tgfTYFjYIJQIyNPg2BjgU0f/rBCWDUVFjVXQkBXNhcXNlcAAAMAK//sBKEFTQA9AE8AXwD0QBhzToNOAnlRiVECZVh1WIVYA2lTATklASC4/+izCQ5IHLj/6LMJDEguuP/wQD0JDEglEgEGEhYSAkhJGSNJPjA+ATA7ATs7MUkwa1ABDBQcFGwUAyhLUxQEPi1QNAUEGXA+gD6QPgM+PjAZuP/AQD8QE0g/MAEZMBkwYVZID0ALF0gPYC1wLYAtA2VQASlQAQVQNC0ECjBFS1VLZUsDSxQwKFMFW0NRHgM3W1EAChYAPzPtMj/tEhc5XS8SFzldXV0BLyvtEjk5Ly9dKxI5L10RFzkSFzldXRDtMi9dXRDtEO0xMABdXSsrK10BXQBdAV0AXQUiLgInDgMjIi4CNTQ+AjcuAzU0PgIzMh4CFRQOAgceAxc+ATcXDgEHHgEzMjY3FQ4BATQuAiMiDgIVFBYXPgMDLgEnDgEVFB4CMzI+AgQwKUxDOhYcR1ZnO22eZjEtTms+DxsVDCtXhFlFdlYwRHKTTh8+REoqKj8UkRpXMSthKBowFRg4/rsYLUAnLEk1HiYXQHFVMUpZoUJVXiBAYUEnRzwxDBUjLxoZ)";
 const char* FontBase64Part_1 = R"(MiYYOmaKUE1+Z1EgHERJTCU+bVEuI0RkQEdsVkYhNmRgXS5Xxnkri+VeNjMHCYcLCwRJIjgnFhkuQypBdCsbMjpH/Mtk4XQulWU0XEQnEx4mAAAAAAEB9gNNAtYFzAADABxADQOWAAIBAgIEBQAAAgAAPzMvERIBOS9d7TEwASMDMwKsjSngA00CfwAAAQFW/lcDewXMABUAKEAWEAbwEQ8FHwUCBQUXAPAACwELEAAGGwA/PwEvXe0SOS9dM+0yMTABFB4CFyMuAzU0PgI3Mw4DAhEpWIlgvlyHWSsrWYdcvmCJWCkCEor05uF2cdvm+5CQ+eXZcXbh5vQAAAEBUP5XA3UFzAAVACRAEwDwCwsXEQXwEAAGEAYCBhAABRsAPz8BL10z7TISOS/tMTABFA4CByM+AzU0LgInMx4DA3UqWIdcwGCKWCoqWIpgwFyHWCoCFJD75ttxduHm9IqJ9ObhdnHZ5fkAAAEA+AL8A9QFywAOAK9AF1sGawYCAANQA2ADAw8JXwlvCQMLAwcIuP/AQEwLEUgICAoNBQRACxFIBAQCDg4KDQ5wCoAKAgoGDgANEA0CDQ0PEAIKCgELAAx1DIUMAgMJBAh/C48LAgsIBgkMCwUNBXAHgAeQBwMHuP/AtgkMSAcHDQAAPzMvK10zEhc5L10RMxEzXREzETMzETMREgE5L13NOcRdKwEYEE3kOS8rMxESOS8rMzEwX15dXQBdASUXBRcHCwEnNyU3BQMzAp8BCC3+5rl3lpx3vf7oLQELDIgEpGeESfpIAQL/AEj4SYZrASkAAAABAHQAtARXBJ4ACwBJQCULDgEEAg4ECQGqQAYAAgEKAwICDA0CDgQHBQ4wBwEHAAStCQWzAD8z7TLGXSsAGBBN5hESATkvX15dMxrtMsYrARgQTeYxMAERIxEhNSERMxEhFQKvk/5YAaiTAagCYP5UAaySAaz+VJIAAAAAAQED/pUCtQErAAMAOUAnCQAZAAIAEA4RSAkCGQICAhAOEUgBmQKXA5ovAG8AfwADAACcAZsEABD27QEvXe397TEwK10rXQETIQEBA6kBCf7J/pUClv1qAAEBTgHQA34CcAADAB1ADwMDBQAAEAACAAC6LwEBAQAvXe0BL10SOS8xMAE1IRUBTgIwAdCgoAAAAQHwAAAC2wErAAMAGkAMA5YAAAEAAAQFAZsAAC/tERIBOS9d7TEwIREzEQHw6wEr/tUAAAEAcv/sBFkFzAADAD1AHIoBATkBaQF5AQMBAhACAgWFAwE2A2YDdgMDAwC4//C3AAABAAMZAQAAPz8BL104Ml1dEjkvODNdXTEwFwEzAXIDNbL8zxQF4PogAAAAAwB8/+wETwVaABMAJwArAHlAUjYgAUYRVhECRg1WDQJJB1kHAkkDWQMCECogKgJAKlAqAgApASopKikeAG5AFFAUAgAUARQULR5vAAoQCgIKTygBTyhfKAIoKSkjGXMPByNzBRkAP+0/7RI5L81dcQEvXe0SOS9dce0SOTkvL11dcTEwAF1dXV1dARQCDgEjIi4BAjU0Ej4BMzIeARIHNC4CIyIOAhUUHgIzMj4CJTUzFQRPTYW0Zmeyg0tLhLRqZbGETLcoTnFITHRPKClPcklHck8r/ljrAqPD/vekR0ejAQrDzAEMn0BAn/70zJ/UfjQ1ftOfmtKAODiA0iL5+QAAAAABAJQAAARqBUUAEgBZQDkAEQERERBvAggIHwEBDwE/AU8BXwGPAZ8BrwEHAQEOEAIBEAJwAoACAwICExQIcwkJAw4GEAFzABgAP+0yPzMzL+0REgE5L11xMzMvXXEzLxDtMi9dMTAzNSERDgMjNTI+AjczESEVnQG3E2B9jkJKj3xgGqYBYZED/ShHNB+UIj1UMvtMkQAAAAEAkAAABDwFWgAmAIdAXHUGhQYCOSABdBuEGwJ2GoYaAncVhxUCdxaHFgJpCgFrEAFZEAEFGgEmJh1uHwg/CAJvCL8IAggIACgSbhMTAGAkcCSAJAMkJM8AAQAAEAACABISDXMYBwEkcwAYAD/tMj/tMy8BL11dMy9dETMv7RESOS9dce0yLzEwAF1dXV1dXV1dXV0zNT4FNTQuAiMiDgIHJz4DMzIeAhUUDgQHIRWQLJCjpYVUJ0dhOzZdRiwHuAlAb6Jqaad1PlaHpJyAIALTdWGkkYSBhUo8VzkbHjxZOxFMhmU6MF2KWV6hkIKAgUaSAAABAID/7ARLBVoAOwDmQGN1OYU5AmM5AUA5UDkCeDSINAJsNAFLNFs0AnQvhC8CBi52LoYuA3cphykCbCUBWiUBYxIBZA0BVQ0BeQiJCAJ5B4kHAnkDiQMCewKLAgI2GjFuPyBfIAIgIABuE0ATAQATARO4/8BAPBUYSBoTGhMKPSZuJycLbs8K3wrvCgMAChAKAgo2GXMaGhAsJiYjcywHEHMFQAuQCwJAC5AL8AsDCwsFGQA/My9dcRDtP+0zLxESOS/tOQEvXV3tMy/tERI5OS8vK11xEO0zL3HtETkxMABdXV1dXV1dXV1dXV1dXV1dXV0BFA4CIyIuAic3HgMzMjY1NC4CKwE1MzI+AjU0JiMiBgcnPgMzMh4CFRQOAgcVHgMESz95snSCtHQ6CboIK0ptSYibRWd5M2ZiM25bO4WDd5MMtQtQe55Zd6lsMyVJb0pSfVQrAXJbkWQ2QWuJSRE4XEIkfnlEWjUWnBk3WT9qd3pvDl2KWy04YIFJN2dWQA8ECTxXagAAAAACAGcAAARlBUUACgANAFVANWkGeQaJBgN/CQEJCQgBbw0GkAKgAgICAg8MbxAEAQQABHMIBQ8MHwwvDG8MBAwMAQsGBgEYAD8/MxI5L10zM+0yAS9d7RI5L10zM+0yMi9dMTBdAREjESE1ATMRMxUJASEDqbT9cgJ7x7z+kP4MAfQBP/7BAT+MA3r8iI4DQ/1LAAAAAQCA/+wESwVFACwAjkBeaQh5CIkIA2kHeQeJBwNKF1oXAkUTVRMCIkANEUgiIgBuFSUkIR9vICAKQBUBABXAFdAVAxUVLgtu8AoBzwrfCgIAChAKAgolcyAgGnNvKAEoKBAkcyEGEHMFCwsFGQA/My8Q7T/tEjkvXe0zL+0BL11dXe0SOS9dcRI5L+0zMjIQ7TIvKzEwAF1dXV0BFA4CIyIuAic3HgMzMj4CNTQuAiMiDgIHIxMhFSEDPgEzMh4CBEtAfrt7b6VyQw62CyhFZUhGclEsKk5xSC1MQTUXsC8DIf2FHTCQY2modkABvGSre0Y0W3pGFShLOyMrUHVJPGdMKxAcJRQC2JH+VyU1QHGcAAAAAgCX/+wESAVaACQAOACrQH16A4oDAnoCigICaAN4A4gDA2cjdyOHIwNnIncihyIDRTdVNwJDMVMxAkotWi0CSydbJwIcGywbPBsDFW4UFABuryUBQCUBACXAJdAlAyUlOh0vbpAKoAoCAAoQCuAK8AoECipzbyABECAgIAIgIDQYcw+PFQEVFQ8HNHMFGQA/7T8zL10Q7RI5L11d7QEvXXHtMhI5L11xce0yL+0xMABdXV1dXV1dXV1dARQOAiMiLgI1NBI+ATMyHgIXBy4BIyIOAhU+ATMyHgIHNC4CIyIOAhUUHgIzMj4CBEg7c6pve7h6PUWCu3ZIfmdOF6wce1FKeFQtMbJzYJ1vPLckSGpGMWRRMyhLakJBZ0gmAb5kq31GXaz1mLEBELhfHkNuUB9bUUWGxYFbXz5yoGtDcFAtIUFiQUiBYjktUnQAAAAAAQCeAAAELQVFAA4ANUAQBW4GBgwAbwsLEAAMEAwCDLj/wEALFBhIDAAMcw0GBRgAPz/tMgEvK10SOS/tEjkv7TEwAQYKAhUjNBoCNyE1IQQtYKuCTLxQhrBh/R8DjwS6iv7a/s/+xp+eATsBMgEkhZEAAAADAIX/7ARGBVoAKQA9AFEAtkB+dSiFKAJ2DIYMAngCiAICeAiICAJ3HYcdAnkiiSICeBKIEgJqRgFqQAFlUAFlSgFlPAFlNgEkEB80bhUfbioVKhUqCgBuQD4BAD7APtA+Az4+U0hu4ArwCgLPCt8KAgAKEAoCCiQQEENzOTlNdhqGGgIvcxoHeQWJBQJNcwUZAD/tXT/tXRI5L+05ETMBL11dXe0SOS9dce0SOTkvLxDtEO0SOTkxMABdXV1dXV1dXV1dXV1dARQOAiMiLgI1ND4CNzUuAzU0PgIzMh4CFRQOAgcVHgMDNC4CIyIOAhUUHgIzMj4CEzQuAiMiDgIVFB4CMzI+AgRGOXW1fXy1dzkvT2U2O10/ITlwpm1zqW82IT9dPT1oTSveGz5kSUZjPxwWOmZQVmY3ESMcRHNWT29FICBGclFTb0QdAXpUkWw9PWuRU0dzVDQJBA4+VGQ1RH1gOTpgfkQ0ZFQ9DAQKNVRxAjMvUjwjIzxSLyVSRS0uRVL9uy1ZRywsSFovO2VKKilLZwAAAAACAI3/7AQ/BVoAJAA4AKVAd3oIiggCegeKBwJnIHcghyADaBp4GogaA0U3VTcCRTFVMQJKLVotAksnWycCExEjETMRAxMAbj8ljyWfJa8lBMAl0CUCJSUdOgtuCgovbuAd8B0Czx0BAB0QHQIdNHMTGEATFkgYGA4qcyIHDnMFcAuACwILCwUZAD8zL10Q7T/tEjkvKzPtAS9dXV3tMy/tERI5L11x7TMxMABdXV1dXV1dXV0BFAIOASMiLgInNx4BMzI+AjcOAyMiLgI1ND4CMzISBzQuAiMiDgIVFB4CMzI+AgQ/RoS9d1GCZkgWrBx3W0p4VTEBFUldazhgm2w7P3ivb+zxxCVJa0ZBaEgnI0ZoRTJnUzUCv7H+8rddIUZwTxtbVUSExIEvSjMbRHqpZWipeEL+tLBJg2M7LVNzRkJzVzIiQ2UAAgHwAAAC2wQ6AAMABwAkQBIGBQOWAAABAAAJCASbBQ8BmwAAL+0/7RESATkvXe0zMjEwIREzEQMRMxEB8Ovr6wEr/tUDDwEr/tUAAAIBYP6VAxIEOgADAAcAAAERMxEBEyEBAfDr/oWpAQn+yQMPASv+1fuGApb9agAAAAEAdACaBFcEqgAGAHe1AAFSBQQFuAENQBAGABQGAAUGAQIBUgMEAQQDuAENQCgCARQCAQMCBggEAAAQAAIAAQAEBAIFPwZvBn8GAwZAEhVIBgMPAgECAC9dMy8rXTMSOT0vMzMBGC9dMxDe1MGHBCsQAcGHBCsQxBABwYcEGCuHK8QxMBM1ARUJARV0A+P8pgNaAjvNAaKa/pL+kZkAAAACAHQBWARXA+wAAwAHAExANwcCCQQAARABAgEFrR8EfwSfBK8EvwQFBEASFkgEAK0wAVABYAFwAQRQAXABgAGwAdABBQ8BAQEAL11dce0vK3HtAS9dMxDOMjEwEzUhFQE1IRV0A+P8HQPjA1iUlP4AlJQAAAEAdACaBFcEqgAGAHe1BgFSAQIBuAENQBAABhQABgEABQQBUgMCBQIDuAENQCgEBRQEBQMEAgYIBAAAEAACAAYFAgIDDwQBBAE/AG8AfwADAEASFUgAAC8rXTIvXTM5PS8zMwEYL13EEM4yEMGHBCsQAcGHBCsQxBABwYcEGCuHK8QxMDc1CQE1ARV0A1r8pgPjmpkBbwFumv5ezQAAAAACAF4AAAQxBVoAJwArAG1ASWkGeQaJBgNpBHkEiQQDShtaGwIHJRclAmYAdgCGAAMJK5gKKCgeAJgAEwETEy0dmB4KQA8USAoKIymdKGYjdiOGIwMdHRieIwQAP+0zL10v7RE5LysBL+0SOS9d7RI5LzPtMl0xMABdXV1dARQOBgcjPgc1NC4CIyIOAgcnPgMzMh4CATUzFQQxJT5PUk8/JwGvAic+TlBNPCUpTW1ERG9SMge4DEp+sHBssX5E/Y/DA+pFaFJCOztEUzdDZlFBOztEUzU3VDkeJkdlPgxal2w9MF2J+7zJyQAAAAIALP7lBKUFzABfAHgBO0CRAUQRRAI1P1U/dT8DAT4RPgJsNHw0jDQDFxgLDkhsCHwIjAgDbGZ8ZgJKZlpmAiZdAWpTAWVJdUmFSQN/P48/Aj9ACw5IfjkBA28qfyqPKgMCTypfKgIXGAsOSGo3ejeKNwNpUQFLD0wfTAJMTFYA0zcpL9MKYCgKatIaN0AUGEgQNwEvGj8aAjcKGhoKNwN6Qbj/6LUNEUhB01a4/8BAJhcgSFYyb9YVDwUVY9YhKCgZJgEmIQ8VHxUvFZ8VrxUFkCGgIQIhuP/AQBcJDEhLFSEhFUsDRjwQDRFIPNVbAEbVUbgBDwA/7T/tKxIXOS8vLytdXREzXTMvEO0RMzMQ7TIBLyvtKxIXOS8vL11dKxDtETMzEO0yEO0ROS9dMwBdAV0xMAArXV9dX10rXV1dXV1dAV0rXV1dXQEUDgIjIi4CNTwBPgE1Iw4DIyIuAjU0PgQzMh4CFzM3MwMOAxUUFjMyPgI1NC4CIyIOAQIVFB4CMzI+AjcXDgMjIi4BAjU0GgE2MzIeARIFNCYjIg4EFRQeAjMyPgI3PgMEpSlOckgeNCcWAQEGDy47SSo/VjUXFyxBUWI4Kj4rHAkFIHRjCA8LBh0UKEEvGTVllGB4u39CO2+iZjtmWVEmRythb35Jf8yOTVSh6ZaDw4A//mJGOyVANCgbDgsbLCAnRzouDQMIBwQC85DvrGAQJTwsAgsMCgMnRzYfQWuLSkyWiHVVMBsvPySX/gUqUUk9FTQkUJHJeYHgpmCG5/7IsZj6s2IZKjohVyVENR9x0AEmttEBYwEEknbI/vh2am0sS2Rxdzk8Z0srN2SPVxM0NjEAAAACAAAAAATMBUUABwAUAHJAQhMCAwUBUgMNA14EBRQEBQMEFAEABgFSAA0AXgcGFAcGDQQQBwEHBxZ/BI8EAgQHAQJfFBMTWg0BSw0BDQYFAwQAEgA/Mj8zM11dOS8z7TIvAS9dETMvXRI5hyuHK8QQwMAQAMGHBRgrhyvEEMDAMTAhAyEDIwEzCQEuAycOAwcDIQQKiv3NicQB/tkB9f3xDRwXEQQEEBcZDZcBzwF+/oIFRfq7A7omTkY1DAw2Rk4l/lkAAwCiAAAEgAVFABYAIQAuAHdAT2UtAWokAWYgAXsCiwICdAuEC5QLAwcLAW8SAUsSWxICEikNWhdADRRIFxcGAFoAIgEiIjAcKVoABhAGoAawBgQGEihfHBwpG18HAylfBhIAP+0/7RI5L+05AS9d7TISOS9d7RI5LyvtETldXTEwAF1dXV1dXQEUDgIjIREhMh4CFRQOAgceAwE0JisBETMyPgITNC4CKwERITI+AgSAVI68aP4oAZx1uIBDIUNkRFWDWC7+7peX3+FRckghUTNdglD8AQpJfVszAXxnkFsqBUUmT3xWOGVROw4JOFdxAihrW/5gHzlQ/dk/WDka/iIXOF4AAAAAAQBx/+wEdgVaACkApEAtOScBRh1WHWYdA2YcATYDASAfMB8CYB9wHwKgHwEfHyBAHSRIICAKCwuwCgEKuP/AQEUJDEgKCit2AIYAAgBbMBVAFVAVAwAVEBUCFUYaVhoCJV8aICAaBBAKIAowCmAKcAoFMAqACtAK4AoECgpJEFkQAgVfEBMAP+1dMy9dcT8zLxDtXQEvXXHtXRI5LytdMy8RMy8rMy9dcXIxMABdXV1dARQeAjMyPgI3Fw4DIyIuAQI1NBI+ATMyHgIXBy4DIyIOAgE6KFSDXD9lTzoVnxxSdJtmjc2HQUCEyoplmG9NGagPNElhPFl/UiYCqYPLjEgwTmY2QUaFaUBluAECnqYBAa9bN115QkEuWEQqRIfHAAAAAAIAogAABGUFRQAMABcAYUBFdQKFAgJ6EIoQAnAXgBcCFBckF2QXA38Pjw8CGw8rD2sPAzQLATQKATsDAQBaAA2gDQINDRkUWgAGEAYCBhNfBwMUXwYSAD/tP+0BL13tEjkvXe0xMABdXV1dXV1dXV0BFAIOASMhESEyHgIHNC4CKwERMzISBGVQmN2M/o4BN57zplXAOHKsdXmi1M4CsKj+/65ZBUVNovqsh8B5OfvzAQoAAAEAogAABGIFRQALAFpAOwdAChRIBwcACgMDAAoBCgoNBQlaAAAQAAIACF8PBT8FfwWPBQRvBY8FnwW/Bd8FBQUFCQRfAQMJXwASAD/tP+0SOS9xcu0BL13tMhI5L10zLxESOS8rMTAzESEVIREhFSERIRWiA5f9KAKc/WQDAQVFnP5amv4znAABAMIAAAQ9BUUACQBHQC0CAgYICAsBBVoABhAGAgYEXz8BfwGPAQM/AW8BnwEDAUAVKUgBAQUAXwcDBRIAPz/tEjkvK11y7QEvXe0yEjkvEjkvMTABESEVIREjESEVAYECpP1cvwN7BKn+Ep794wVFnAAAAAEAcf/sBE8FWgApAIhASggCARUeJR51HoUeBFUSAScnCiWvFQEVFRQUAFrAJdAlAn8ljyUCACUBJSUrNh12HYYdth0EHVswCkAKUAoDAAoQCgIKJ18oKCAPuP/wQA4NEUgYXw8VFQ8EIF8FEwA/7T8zLxDtKxI5L+0BL11x7V0SOS9dXV3tMi8zL10REjkvMTAAXV1dJQ4DIyIuAQI1NBI+ATMyHgIXBy4BIyIOAhUQEjMyPgI3ESE1IQRNJF90iU6GxoJAPoLIiWSXb0sYqyaLb1p+TyOprDBTQzEN/tsB34UYNi0eaboBAZmnAQGvWjRZeUU4bnlFh8eC/vT+6hEXGQkBUKAAAAEAogAABCoFRQALAFdAPAtaCB8ALwA/AG8AfwAFbwB/AI8AvwAEAAANBwNacAQBAAQQBKAEsAQEBAJfUAcBoAewBwIHBwkFAwQAEgA/Mj8zOS9dce0BL11x7TISOS9dcTPtMTAhESERIxEzESERMxEDa/32v78CCr8Cb/2RBUX9ygI2+rsAAAABAMoAAAQBBUUACwBZQDgGBgEOBAcHAAAJDnAAAQAEWg8JPwmPCZ8JBE8JXwl/CY8JzwnfCQYQCQEJCQwNBAhfBxIDC18AAwA/7TI/7TIREgE5L11dce3EXSsRATMYLxBN5DIvMTATIRUhESEVITUhESHKAzf+xAE8/MkBPP7EBUWc+/OcnAQNAAAAAAEAsP/sA9oFRQAVAEu3ZRB1EIUQAwu4/+hAIg0RSBMTCABaEREIF4AJAQkJAAgQCAIIE18UAw5fBQkJBRMAPzMvEO0/7QEvXTMvXRESOS/tEjkvMTAAK10BFA4CIyImJzceAzMyNjURITUhA9ozZZZiq8wjuwoqOkkpaGn+yQH1AaRko3M+ssAfQF08HY+KAwmcAAABAKIAAATLBUUACwCXQDR0CoQKAkYKVgpmCgNkB3QHhAcDjQABawB7AAJJAFkAAjkKARQKAQEgCxFICgELcgmCCQIJuP/gQC0LD0gICRAJCQALEAALEAsCCwsNBwNaAAQQBAIEAgcKAXYHhgcCBwEIBQMEABIAPzI/Mzk5XREzETMBL13tMhEzL104MzMvODMrXRE5OQArMTBdXQFdXV0AXQFdXSEBBxEjETMRATMJAQPr/hmjv78CPOH+CAJFAn6p/isFRf1fAqH9xPz3AAAAAQDtAAAETAVFAAUAJkAWBAQHA1ovAD8AAgAAEAACAAEDA18AEgA/7T8BL11d7RI5LzEwMxEzESEV7b8CoAVF+1ecAAABAIEAAARLBUUALACZuQAe/+hAEw0RSCYeNh4CKhgNEUgpKjkqAgy4//BAGQsRSA0QCxFIDQwkJBwsXCoAQBkcSAAALh64//BADQoRAEweG1wAHBAcAhy4/8CzKC1IHLj/wEAJGB5IHAYVFR0kuP/AQAwOEUgkDQ0qHQMcABIAPzI/MzkvMysRMxEzAS8rK13tMisSOS8rM+0ROREzMysrMTBdK10rIRE0Njc2NwYHDgEHAyMDLgMnJicWFx4BFREjETMTHgEXFhc2Nz4BNxMzEQOpAQICARERDiEOpImmBg4PEAgSEwEBAQGg)";
 const char* FontBase64Part_2 = R"(7bkJFwsMDQ4MCxgJueEDZDNqLDMxNzUtZCb+SgG2DykvMRg3PDA0LWkz/JwFRf4XF00mLDEvKyVOGQHq+rsAAAABAKIAAAQqBUUAEwB4QCQSXAAYCRFIAIARkBHQEeARBD8RAcAR0BECbxF/EY8RAxERFQq4/+hALQsRSAoHXHAIAQAIEAigCLAIBAiMAQF6AQFpAQERAQkDgwsBdQsBZgsBCwAIEgA/MzNdXV0/MzNdXV0BL11x7TIrEjkvXV1xcTMr7TEwIQEWFx4BFREjETMBJicuATURMxEDRP34BAQDBareAhAFBAQFrARqKy0mWSf8lAVF+44oLidiMwNg+rsAAAAAAgBm/+wEZgVaABEAHQB5QFZ2HYYdAjQdAXYZhhkCNBkBeReJFwI7FwF5E4kTAjsTAVYQAUUQAUYNVg0CSQdZBwJJA1kDAgBbXxIBEkAZHEgAEgESEh8YW1AKARAKAQoVXw8EG18FEwA/7T/tAS9dce0SOS9dK3HtMTAAXV1dXV1dXV1dXV1dXQEUAg4BIyIuAQI1NBI+ATMyAAMQAiMiAhEQEjMyEgRmRoS/eH/AgEBEgr989wEIyZ6YnJyemaOUAqmt/vqxWV6zAQWnrQECrFb+pf6qAQ4BB/75/vL+8v7sARgAAgCiAAAEXwVFAA4AGQBbQD5mFwF2AIYAAkkPWQ9pDwMAWn8Pjw8CD0AZHEgADwEPDxsUB1oACBAIoAiwCAQIBl8UQAkRSBQUBxNfCQMHEgA/P+0SOS8r7QEvXe0yEjkvXStd7V1dMTAAXQEUDgIjIREjESEyHgIHNCYrAREzMj4CBF87ebZ7/ue/Acx9unw+wKSk9v5SeU8mA7FUm3hI/f4FRTpqlV59gf3tK0pmAAACAGb+fQRxBVoAIAAsAItAYjUsdSyFLAM1KHUohSgDOiZ6JoomAzoieiKKIgNpEXkRiREDSgRaBAJGH1YfAkYcVhwCBVoUCwsAWyFfIQEhQBkcSAAhARQhFCEuJ1tQGQEQGQEZJF8eBAUqXxQTCGBfDwEPAC9d7T/tMz/tAS9dce0SOTkvL10rcRDtMi8Q7TEwAF1dXV1dXV1dARQOAgceATMyNjcVDgEjIi4CJy4DNTQSPgEzMgADEAIjIgIREBIzMhIEZjNijVophmUcQBcmWzFVgWFGG3CocThEgr989wEIyZ6YnJyemaOUAqmT66xtFn5yCAWGCQ0zX4pXC2ey+ZytAQKsVv6l/qoBDgEH/vn+8v7y/uwBGAAAAAIAogAABJkFRQARABsAl7kAGv/wsw8ATRC4/+BAIw8RAEyJAQELAAEAIA4RSAAREBERAQQQARAQA3YLhgsCC1oSuP/AQDYVGEh/Eo8SAgASARISHRYDWgAEEASgBLAEBAQQAl8fFn8WAj8WbxafFu8WBBYWABVfBQMEABIAPzI/7RI5L11x7TIBL13tMhI5L11dK+1dETkvXTMyLzgzK11dMTArACshASMRIxEhMh4CFRQOAgcBAzQpAREhMj4CA73+ku6/AeJ4s3c7J1SCWwGQ+P7Q/vABGFNxRR8CP/3BBUUzYYpXPntnTA/9qwPN3/4qKENaAAAAAQBP/+wEaAVaAD8AsEB5ND0BbS0BSx1bHQJrEAFgDAF0PoQ+AnQ9AUA9UD0ChjwBRDxUPAJ2N4Y3AnQnhCcCBCF0IYQhA1QLAYkHAXoHAYsCAXkCASpaKSkAWgATARMTH0EJWn8IjwgCCDRaAB8QHwIfNBMFL2AkKiokBA5fBUAJUAkCCQkFEwA/My9dEO0/My8Q7RI5OQEvXe3WXe0REjkvXe0yL+0xMABdXV1dXV1dXV1dXV1dAV1dXV1dARQOAiMiJCc3HgMzMj4CNTQuAicuBTU0PgIzMh4CFwcuAyMiDgIVFB4CFx4FBGg+f8OG6v77JLkMMFR6VUh3VTBBaoVEMmZeUT0iSH6sZHSjcUQUvAsrR2REUGxCHTVbeUU3cGdZQiYBclWPaDq4riU3WkEkGzpaP0ZYOCMRDR0nNUtlQ2CJVygpUnlQITNQNhwhOU4tPEsxIBIOHyo5Um4AAAEATAAABIAFRQAHAEpAMQcOAQQCDgQBWg8CPwKPAp8CvwLPAgZPAl8CfwKPAs8C3wIGEAIBAgIICQAEXwUDARIAPz/tMhESATkvXV1x7cYrARgQTeYxMAERIxEhNSEVAsW+/kUENASp+1cEqZycAAABAI7/7AQ9BUUAGQBeQERlFXUVhRUDZQ91D4UPAwBagBeQF9AX4BfwFwU/FwHAF9AXAn8XjxcCFxcbDVqPCp8KrwoDzwoBAAoQCgIKGAsDEl8FEwA/7T8zAS9dXXHtEjkvXV1xce0xMABdXQEUDgIjIi4CNREzERQeAjMyPgI1ETMEPTp3tXp0rnM6vxk9aVBTb0QdvgHqicJ7ODV1u4cDbfytYYpYKChZkGcDRgAAAAEACgAABMIFRQAQAIJAVQ8gDhFIKQ85DwIrDwF2A4YDAlQDZAMCNgNGAwIkAwEAAVIPCQ9eEAAUEBAAAQFSAwkDXgIBFAIBAwIJAhAQARAQEn8CjwICAg8CA1UJAUQJAQkAARIAPzMzXV0/MwEvXREzL10SORAAwYcFK4crxIcYECuHK8QxMAFdXV1dXV0rISMBMwEeARcWFzY3PgE3ATMCycb+B8kBQBAdDA4NDA4MHhABPskFRfx6LWEqMC8tMCliLwOGAAAAAQAAAAAEzAVFADIBTEARIQgMAE0CGBAATQIYCwwATBC4/+i0CwwATBq4//BAEBARAEwxGBEATTEYCwwATBS4//C0CwwATCO4/+BAHAsPAEwiGAsPAEwiEAoATQEgCxEATAAgEBEATAC4/+C0DQ4ATAC4/+C0CQoATBK4//BAERARAEwSKA0OAEwSKAkKAEwRuP/gQBMLEQBMIgkyCQICBAkBAQFSIysjuAEHQAwJARQJASMRAVIiGiK4AQdASAkRFAkJEQABUjErMV4yABQyMgASAVIUGhReExIUExIUEysJGgMTEDIBMjI0EwkvIk8iXyIDIiIaMRMDKxoAASQaARoRAQMSEgA/FzNdETMRMz8zEjkvXTMBLxEzL10SFzkQAMGHBSuHK8SHGBArhyvEhxgQK4crxADBhwUYK4crxABdX10BKysrKysrKysrKysrKysrMTArKysrISMDLgMnJicGBw4DBwMjAzMTHgEXFhc2Nz4DNxMzEx4DFxYXMj4CNxMzA/rQaAUODw8HERESEQcPDw4FatDTvW0ICwUFBBAQBw4PDgZtr20GDg8OBxAQAQYKDAZovQGDEzQ7Px5GTE1GHj87MxP+fQVF/L1BfDE5M0VDHT08NxcBj/5xFjg7PR1DRkRmejYDQwAAAQAkAAAEqQVFAAsAyEBcCQkBCwYBCQNZAwIpAQEEAQEDAgcAAQgLBAsGAgcJAQgKBQoGAwIHAgkAAQcCAVIBCAcIAV4CBxQCAgcFCgFSCwQFBAteCgUUCgULChAKIAoCAgoCCgMGAAkECAS4/8BAGAocSAQEDQhACxtICAAJAwYEAQgEEgoBAwA/Mz8zEhc5AS8rETMvKxIXOTk5Ly9xEADBhwUrEADBhwUrEMSHGBArEADBhwUrEMQQwMAQh8DAEIcIwAjAEIcIwAjAMTABXV0AXV1dCQEzCQEjCQEjCQEzAmYBTc3+TQHczf6K/ovNAdz+Tc0DRAIB/Xz9PwI9/cMCwQKEAAAAAQAkAAAEqAVFAAgAlkBoNAZEBlQGA1wHATsHSwcCCQcZBykHA1MFATQFRAUCAwAFEAUgBQMMBQcIDgEEAg4FLwQBBAYBWg8CPwKPAp8CvwLPAgZPAl8CfwKPAgQQAgECAgoJBgNAAFAAYAADPwABAAABBwQDARIAPz8zEjkvXV0zMxESATkvXV1x7TnGXTIrARgQTeYyMTBfXl1fXV1dXV0AXQERIxEBMwkBMwLEvP4czQF2AXTNAkj9uAJIAv39nQJjAAEASQAABIMFRQAJAHVAJokIAWkIAVcIdwgCKQg5CEkIAwQIFAgCCAFSAwIDXgcIFAcIAwcEuP/Asw8USAC4/8BAHQkOSAQHAAAHBAMLLwE/AU8BAwEHBF8FAwIIXwESAD/tMj/tMgEvXRIXOS8vLysrEADBhwUrhyvEMTABXV1dXV0pATUBITUhFQEhBIP7xgMy/RcDwvzOA2GPBBqci/viAAAAAQGa/lcDvQXMAAcAL0AcAgcHCQXyfwCPAAI/AG8AAgAAAQAE9QEABfUAGwA/7T/tAS9dXV3tEjkvMzEwAREhFSERIRUBmgIj/pEBb/5XB3WL+aGLAAAAAAEAc//sBFoFzAADAD9AHYsAAXoAATkAaQACAAMQAwMFhQIBNgJmAnYCAwIBuP/wtwABAQECAAAZAD8/AS9dODNdXRI5LzgzXV1dMTAFATMBA6T8z7IDNRQF4PogAAAAAAEBDv5XAzEFzAAHAClAFwfyYAIBAgIJBAAAMAACAAT1BQAB9QAbAD/tP+0BL10zEjkvXe0xMAE1IREhNSERAQ4Bb/6RAiP+V4sGX4v4iwAAAQCFAboERgVFAAYAY0AvhQUBeQSJBAIFBAGMAAEpAGkAeQADAAEDBhAABhAGcAaABgQGBghmAnYChgIDAgO4//BADwADAQMAARABAgIAAAEEAwA/MzMvMl0BL104M10SOS9dOBI5M11dETMzXV0xMAkCIwEzAQOs/rf+upgBessBfAG6AyP83QOL/HUAAAAAAf/7/yQE0f+EAAMADrQDAAC7AQAv7QEvLzEwBzUhFQUE1txgYAAAAAEBkgSxAzoFtAAFABpADnQDhAMCgAQBBAEDjACTAD/tAS/NXTEwXQElNTMXFQK+/tTF4wSx5h3vFAAAAAIAgP/sBIgETgAyAEEApUA/iiQBeh6KHgJpPXk9iT0DJTY1NgITIAkMSAYXFhcCHQktCT0JAwUtFS0CAAMBAwMwRhsMTzhfOAI4OBVDJkcnuP/4QC3AJwEnJz9HABUBFTlRGxszLA8mHyYCLyaPJv8mAyYmIVAsEDNQEgBRBwcMEhYAPzMzL+0Q7T/tMy9dcRESOS/tAS9d7TMvXTjtERI5L10zM+0yL10xMABdXV0rXV1dXSUyNjcVDgEjIi4CJyMOAyMiJjU0PgI/ATU0LgIjIg4CByc+AzMyFhURFBYlMj4CPQEHDgMVFBYETQ8eDiJDJjNJLhgDBhxEWHJKnqBPgKNU7Bs3VDgyUTolBrwKN2SXa8jJKv3aU3pRKL43b1k4WW8EA3AICBs3UTY0VDsgrJZriU4fAQQ7Q146Gw8nQzMRQGtOK7ux/i5QUQY/YHQ1WQQBDzBbTFJkAAIAs//sBEIFzAAgADQAYUBCegKKAgJEM1QzZDMDSyNbI2sjAzoFATUcAQUfFR91H4UfBABHYCEBISE2KwYURgATgBMCEyZQGh4QEwANFTBQBgMWAD8z7T8/PzPtAS9d7TIyEjkvXe0xMABdXV1dXV0BEAIjIiYnIxQOAgcjPgM1ETMRFAYHBgczPgEzMhIDNC4CIyIOAhUUHgIzMj4CBELLvXSqMAICAwMBrgECAgG0AQEBAQQwqXXDxLoeP19CQmpJKChJaUE/YEAhAiL+5P7mVmIaNy4hBAkrPEgnBO3+WR05FhoXaV/+6/7hcKFnMS1nqXx3nl8nLmajAAEAgv/sBDgETgAlAJ1AUmQWAWQQAXkeiR4CZBoBRBVUFQJLEVsRAnUIhQgCC0cKChxHPxtPG48bnxuvGwXPG98b/xsDYBsBGxsnE0cAAAEAcBsBABsQG2AbcBuAG8AbBhu4/8BAHBseSBsbGFAhFg5QBR8LfwuPCwMLQBseSAsLBRAAPzMvK10Q7T/tMy8rXXEBL13tEjkvXV1x7TIv7TEwAF1dXV1dAV1dEzQ+AjMyHgIXBy4BIyIOAhUUHgIzMjY3Fw4DIyIuAoJWjbRfYppvRg3AEIB2VnVHHx9HdVVsjhG+CURynmSJv3c2Ah6j2IA1Mld2RA5baTdpm2Rkn246am0MQ3xeOVaXzQACAIr/5gQZBcwAHwAzAGtAS0QiVCJkIgNLMlsyazIDOgFqAQI1CgEFBxUHdQeFBwQKBBoEegSKBAQTRioAUBIBkBKgEgISEjUgRwAGAQYaFRIAL1ALCBAlUAADFgA/M+0/M+0/PwEvXe0SOS9dcTMz7TEwAF1dXV1dXSUOASMiAhEQITIWFzM0JjQmNREzERQeAhcjLgM1ARQeAjMyPgI1NC4CIyIOAgNeMaJ5yr4BiHmjMQIBAbQBAgIBrAEEAwL94R09YENFa0klJUhqRUBgPyCuaV8BFgEYAjZWYgUqMi0JAaP7EydIPCsJBCQyOhoBbHCgaDEwaah4dJ1gKi5mowAAAAIAhf/sBEYETgAgACsAkEBlZCQBZAMBSSlZKWkpA0kkWSQCdR2FHQJ3HIccAngOiA4Ceg2KDQJEAlQCZAIDJ0cfHwtJzwrfCv8KAwAKEApgCgMKCi0mAEcAFeAVAhUAUCYmBSFQGhAFUBDfCu8KAoAKAQoKEBYAPzMvXV0Q7T/tEjkv7QEvXe0yEjkvXV3tMi/tMTAAXV1dXV1dXQFdXQEUHgIzMj4CNxcOAyMiLgI1ND4CMzIeAh0BASIOAgchLgMBQiZMcUo3XUoyDJ4QQGqYaHO2fkNPhq9gg7VyM/4lLmVWOwMCSAg0TWIB91WPZzkZLD0kLS1bSS9IjtWNnNSCOFSX1IAYAdIdSn9iXn5MIAAAAAEAigAABEsFzAAfAF65AAr/8EA2CQxIHQFGAj8FAQUFBgIeHhEvAj8CbwJ/Ao8CBQJAFCVIAAIBAhECESAhF1AMAAAEUB0FDwEVAD8/M+0yP+0REgE5OS8vXStdETMvETMzL10Q7TIxMAArAREjESE1ITU0PgIzMh4CFxUuAyMiDgIdASEVAkS0/voBBi1kn3IdUFBHFRJIT0gTQmJAHwHrA6z8VAOsjhllj1sqAwYIBJEDBgUDFDZeSwqOAAAAAAIAj/5YBB4ESwAxAEUAnEA+ejCKMAJmPwFFDFUMZQwDSzpbOms6AzUhAQUdFR11HYUdBAoXGhd6F4oXBC9GMiJQDgGQDqAOAg4OGkcGRgW6//AABf/AQCgPFUgFBTxHsBoBABrQGgIaKA83UCIfEEFQDxUVCVAAIAYwBgIGBgAbAD8yL10Q7T8z7T8z7T8BL11x7TMvKzjtERI5L11xMzPtMTAAXV1dXV1dXQEiLgInNx4BMzI+Aj0BIw4DIyIuAjU0PgIzMhYXMzQ+AjczDgMVERQGEzQuAiMiDgIVFB4CMzI+AgJnWoljPQ24EXFcOVtBIwITO1NuSGaQXCsrX5hucactAwMDBQGrAQICAdQhME9lNUNiQB4eP2FCNWZQMf5YJkdiPBlLUSJLeFbCKEw6I0KGyoeDzI1KaWEZPjcoAwkrPEkn/Mbj5QPPcZ5jLC1jnXF1nF4nK2CbAAEAuQAABBkFzAAfAD9AJ3AOgA4CBA0UDXQNhA0EEUYSEiEFAh5GAB+AHwIfHxEVGFAFCxAAAAA/PzPtPzMBL13tMjISOS/tMTAAXV0TMxEUBgczPgMzMh4CFREjETQuAiMiDgIVESO5tQYDAxhAUmlAU4JaL7UhO1AwO2dNLLQFzP56MmUuL0w1HSxckGX9LwK3UGc9GC1VfVH9jQAAAAACAI8AAARlBcwACQANAEhAKAcHBQQEBQtKDAwBAQBGoAUBBQUODwswCmAKAoAKAQoHUAgPAARQAxUAP+0yP+0vXXEvERIBOS9x7TIvMi/tETMvEjkvMTAlIRUhNSERITUhJzUzFQLpAXz8KgGm/sEB88jIjo6OAx6O0sDAAAAAAAIAdf5XA0QFzAAZAB0AS0AsdROFEwIKAxoDAhgYChUaSh0dAEYAFQEVFR4fCjAaAYAaARobF1AYDxBQBRsAP+0/7S8vXXEBLxESOS9d7TIv7RESOS8xMABdXQUUDgIjIi4CJzUeAzMyPgI1ESE1ISc1MxUDREd2nFYpUkxBGBY8SE8oOGFIKf5pAkvIyBxtl18qBwwPCYwFDAoHHD1fQwPFjtLAwAAAAAEA7AAABGUFzAALAK9ALGYHdgeGBwNkCXQJhAkDewGLAQJJAVkBaQEDSQhZCAJrAHsAiwADSQBZAAIKuP/oQCgLEUgBCggJEEQJVAkCCQkAnwuvC78LAwALEAsCCxALCw0HA0YABAEEuP/Asx8lSAS4/8CzFhtIBLj/wEARDRFIBAIHCgEHAQgPBQAEABUAPzI/Pzk5ETMRMwEvKysrXe0yETMvOF1dMzMvXTgzOTkxMCtdXV0AXV0BXQBdIQEHESMRMxEBMwkBA5L+koS0tAHb0/5JAc4B82L+bwXM/GECDf4v/ZcAAAABAIYAAARcBcwACQAzQBoICAUEBAUBAQBGoAUBBQUKCwdQCAAABFADFQA/7TI/7RESATkvce0yLxEzLxI5LzEwJSEVITUhESE1IQLgAXz8KgGm/t8B1Y6OjgSwjgAAAAABAGMAAARkBE4AOQCOuQAq/9CzCQ9IILj/0EBZCQ1IIjlIAAANLki/L88v/y8DYC9wLwIfLy8vPy8DTy9fL38vjy8EEC8gLzAvAy8vOxkMSAANEA0C8A0BDw0/DQLPDd8NAhANAQ01BlAZIigDHxATDy8NABUAPzIyPz8XM+0yAS9dXXFxcu0yEjkvXV1xcXHtEjkv7TkxMAArKyERNC4CIyIOAhURIxE0LgInMx4DFTM+AzMyFhczPgMzMh4CFREjETQuAiMiBhURAhMMGysgITQmFKkBAgIBlQECAgECDSQzRi5YVxMCEis4SC89VDQXqAwbKyBCTQKuT2pBGzNdg1H9oQNTIktDMAcFKTU4FCdHNh9gZC9JMhosXJBl/S8Crk9qQRuoqP2NAAABALMAAAQZBE4AJQA9QCZwIoAiAgQhFCF0IYQhBCVGAAAnGQxGAA2ADQINGQZQHxATDw0AFQA/Mj8/7TMBL13tMhI5L+0xMABdXSERNC4CIyIOAhURIxE0LgInMx4DFTM+AzMyHgIVEQNkITtQMDtnTSy0AQICAaoBAgMCAxhBVWpCU4BXLQK3UGc9GC1VfVH9jQNTIktDMAcFLDk7FC9MNR0sXJBl/S8AAAAAAgCC/+wESQROAA8AIwBZQD1kIgFGIlYiAmQcAUYcVhwCaxgBSRhZGAJrEgFJElkSAgBHrxABABAQEGAQAxAQJRpHAAoBChVQDRAfUAUWAD/tP+0BL13tEjkvXXHtMTAAXV1dXV1dXV0BFA4CIyIuAjUQEjMyEgM0LgIjIg4CFRQeAjMyPgIESUN+tXJtsX1E/ej07r0rTWpAQW5PLS9PaTlBb1AtAh6O04xFRIzTjwEXARn+6v7mfqRiJyljpHt+pWIoJ2KmAAACALP+VwRCBFAAKAA8AGVARGQ7AUY7VjsCaysBSStZKwIGJhYmdiaGJgQ0IQE7CAF5A4kDAgBHYCkBKSk+Mx4RRgASgBICEi5QHiQQGA8RGzhQCgUWAD8z7T8/PzPtAS9d7TIyEjkvXe0xMABdXV1dXV1dXQEUDgIjIi4CJyMeAxURIxE0LgInMx4DFTM+AzMyHgIHNC4CIyIOAhUUHgIzMj4CBEIoXJZuN2RWQxcFAQEBAbUBAgIBrwEDAwMEGT9QZD5ullwouhg7YUk7aE0tJUhqREliOxkCInvQllUULEYyAh8uOh3+WQUDKEo7KgkDJTQ8GjRMMRdQk859ZJxrOCVhrIdznWEqOW6iAAAAAAIAiv5XBBoESgAkADgAZkBHSy1bLWstA0QxVDFkMQM6HAE1AwEFJBUkdSSFJAQKIBogeiCKIAQSRiUFUBMBkBOgEwITEzovRwAiASI0UBkfFhIbKlAFABAAPzLtPz8z7QEvXe0SOS9dcTMz7TEwAF1dXV1dXQEyHgIXMzQ+AjczDgMVESMRNDY3NjcjDgMjIgIREBIBNC4CIyIOAhUUHgIzMj4CAhFC)";
@@ -46,25 +47,17 @@ void NodeCore::InitializeFonts()
 		Fonts.push_back(ImGui::GetIO().Fonts->AddFontFromMemoryTTF((void*)FontData, static_cast<int>(RawData.size()), float(size)));
 	}
 }
+#endif
 
-std::string NodeCore::GetUniqueID()
+std::string NodeCore::GetUniqueID(std::mt19937& RandomEngine)
 {
-	static std::random_device RandomDevice;
-	static std::mt19937 mt(RandomDevice());
-	static std::uniform_int_distribution<int> distribution(0, 128);
-
-	static bool FirstInitialization = true;
-	if (FirstInitialization)
-	{
-		srand(static_cast<unsigned>(time(nullptr)));
-		FirstInitialization = false;
-	}
+	std::uniform_int_distribution<int> distribution(0, 128);
 
 	std::string ID;
-	ID += static_cast<char>(distribution(mt));
+	ID += static_cast<char>(distribution(RandomEngine));
 	for (size_t j = 0; j < 11; j++)
 	{
-		ID.insert(rand() % ID.size(), 1, static_cast<char>(distribution(mt)));
+		ID.insert(RandomEngine() % ID.size(), 1, static_cast<char>(distribution(RandomEngine)));
 	}
 
 	return ID;
@@ -72,7 +65,13 @@ std::string NodeCore::GetUniqueID()
 
 std::string NodeCore::GetUniqueHexID()
 {
-	const std::string ID = GetUniqueID();
+	static thread_local std::mt19937 RandomEngine(std::random_device{}());
+	return GetUniqueHexID(RandomEngine);
+}
+
+std::string NodeCore::GetUniqueHexID(std::mt19937& RandomEngine)
+{
+	const std::string ID = GetUniqueID(RandomEngine);
 	std::string IDinHex;
 
 	for (size_t i = 0; i < ID.size(); i++)
@@ -81,7 +80,7 @@ std::string NodeCore::GetUniqueHexID()
 		IDinHex.push_back("0123456789ABCDEF"[ID[i] & 15]);
 	}
 
-	const std::string AdditionalRandomness = GetUniqueID();
+	const std::string AdditionalRandomness = GetUniqueID(RandomEngine);
 	std::string AdditionalString;
 	for (size_t i = 0; i < ID.size(); i++)
 	{
@@ -92,7 +91,7 @@ std::string NodeCore::GetUniqueHexID()
 
 	for (size_t i = 0; i < ID.size() * 2; i++)
 	{
-		if (rand() % 2 - 1)
+		if (RandomEngine() % 2 == 0)
 		{
 			FinalID += IDinHex[i];
 		}
@@ -105,6 +104,7 @@ std::string NodeCore::GetUniqueHexID()
 	return FinalID;
 }
 
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 bool NodeCore::SetClipboardText(std::string Text)
 {
 #ifdef _WIN32
@@ -197,6 +197,7 @@ std::string NodeCore::GetClipboardText()
 #endif
 	return text;
 }
+#endif
 
 std::string NodeCore::Base64Encode(unsigned char const* BytesToEncode, unsigned int Length)
 {
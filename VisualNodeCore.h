@@ -1,5 +1,8 @@
 #pragma once
 
+// VISUAL_NODE_SYSTEM_HEADLESS is defined by the VisualNodeSystemCore target.
+// In that mode there is no dependency on Dear ImGui or on the windowing system.
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include "windows.h"
@@ -11,14 +14,23 @@
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "imgui.h"
 #include "imgui_internal.h"
+#else
+#include "VisualNodeHeadlessTypes.h"
+#endif
 
 #include <random>
 #include <queue>
 #include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
 
 #include <fstream>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <atomic>
 
 #include "glm/vec2.hpp"
 #include "glm/vec3.hpp"
@@ -32,9 +44,10 @@ namespace VisNodeSys
 #define SINGLETON_PUBLIC_PART(CLASS_NAME)  \
 static CLASS_NAME& getInstance()           \
 {										   \
-	if (!Instance)                         \
-		Instance = new CLASS_NAME();       \
-	return *Instance;				       \
+	/* Thread-safe lazy initialization. */ \
+	static CLASS_NAME* const SafeInstance =\
+		(Instance = new CLASS_NAME());     \
+	return *SafeInstance;			       \
 }                                          \
 										   \
 ~CLASS_NAME();
@@ -67,11 +80,13 @@ return result;
 
 		bool bIsInTestMode = false;
 
-		std::string GetUniqueID();
+		std::string GetUniqueID(std::mt19937& RandomEngine);
 
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		bool bIsFontsInitialized = false;
 		std::vector<ImFont*> Fonts;
 		void InitializeFonts();
+#endif
 		
 		std::string Base64Characters =
 			"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
@@ -83,10 +98,15 @@ return result;
 		// This function can produce ID's that are "unique" with very rare collisions.
 		// For most purposes it can be considered unique.
 		// ID is a 24 long string.
+		// Safe to call from multiple threads, each thread has its own random engine.
 		std::string GetUniqueHexID();
+		// Same as above, but uses the provided random engine (for example one owned by NodeContext).
+		std::string GetUniqueHexID(std::mt19937& RandomEngine);
 
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 		bool SetClipboardText(std::string Text);
 		std::string GetClipboardText();
+#endif
 
 		std::string Base64Encode(unsigned char const* BytesToEncode, unsigned int Length);
 		bool IsBase64(unsigned char Character);
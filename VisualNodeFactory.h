@@ -4,15 +4,18 @@
 
 namespace VisNodeSys
 {
+    // NODE_FACTORY is the factory of the default NodeContext.
+    // Additional factories can be created for independent NodeContext instances.
     class NodeFactory
     {
-        SINGLETON_PRIVATE_PART(NodeFactory)
+        static NodeFactory* Instance;
 
         std::unordered_map<std::string, std::function<Node* ()>> Constructors;
         std::unordered_map<std::string, std::function<Node* (const Node&)>> CopyConstructors;
 
     public:
         SINGLETON_PUBLIC_PART(NodeFactory)
+        NodeFactory();
 
         void RegisterNodeType(const std::string& Type, std::function<Node* ()> Constructor, std::function<Node* (const Node&)> CopyConstructor);
         Node* CreateNode(const std::string& Type) const;
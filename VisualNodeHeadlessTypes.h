@@ -0,0 +1,53 @@
+#pragma once
+
+// Minimal replacements for the Dear ImGui value types that are used by the graph model.
+// This header is only included when VISUAL_NODE_SYSTEM_HEADLESS is defined (VisualNodeSystemCore target),
+// so that the graph can be loaded, edited, evaluated and saved without Dear ImGui or a windowing system.
+// Layout and semantics follow imgui.h, so user code compiles against both targets.
+
+#include <cfloat>
+
+typedef unsigned int ImU32;
+
+struct ImVec2
+{
+	float x, y;
+	constexpr ImVec2() : x(0.0f), y(0.0f) {}
+	constexpr ImVec2(float X, float Y) : x(X), y(Y) {}
+};
+
+struct ImVec4
+{
+	float x, y, z, w;
+	constexpr ImVec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+	constexpr ImVec4(float X, float Y, float Z, float W) : x(X), y(Y), z(Z), w(W) {}
+};
+
+// Same operators that imgui.h provides with IMGUI_DEFINE_MATH_OPERATORS.
+static inline ImVec2 operator*(const ImVec2& Left, const float Right) { return ImVec2(Left.x * Right, Left.y * Right); }
+static inline ImVec2 operator/(const ImVec2& Left, const float Right) { return ImVec2(Left.x / Right, Left.y / Right); }
+static inline ImVec2 operator+(const ImVec2& Left, const ImVec2& Right) { return ImVec2(Left.x + Right.x, Left.y + Right.y); }
+static inline ImVec2 operator-(const ImVec2& Left, const ImVec2& Right) { return ImVec2(Left.x - Right.x, Left.y - Right.y); }
+static inline ImVec2 operator*(const ImVec2& Left, const ImVec2& Right) { return ImVec2(Left.x * Right.x, Left.y * Right.y); }
+static inline ImVec2 operator/(const ImVec2& Left, const ImVec2& Right) { return ImVec2(Left.x / Right.x, Left.y / Right.y); }
+static inline ImVec2 operator-(const ImVec2& Value) { return ImVec2(-Value.x, -Value.y); }
+static inline ImVec2& operator*=(ImVec2& Left, const float Right) { Left.x *= Right; Left.y *= Right; return Left; }
+static inline ImVec2& operator/=(ImVec2& Left, const float Right) { Left.x /= Right; Left.y /= Right; return Left; }
+static inline ImVec2& operator+=(ImVec2& Left, const ImVec2& Right) { Left.x += Right.x; Left.y += Right.y; return Left; }
+static inline ImVec2& operator-=(ImVec2& Left, const ImVec2& Right) { Left.x -= Right.x; Left.y -= Right.y; return Left; }
+static inline ImVec4 operator+(const ImVec4& Left, const ImVec4& Right) { return ImVec4(Left.x + Right.x, Left.y + Right.y, Left.z + Right.z, Left.w + Right.w); }
+static inline ImVec4 operator-(const ImVec4& Left, const ImVec4& Right) { return ImVec4(Left.x - Right.x, Left.y - Right.y, Left.z - Right.z, Left.w - Right.w); }
+static inline ImVec4 operator*(const ImVec4& Left, const ImVec4& Right) { return ImVec4(Left.x * Right.x, Left.y * Right.y, Left.z * Right.z, Left.w * Right.w); }
+
+struct ImColor
+{
+	ImVec4 Value;
+
+	constexpr ImColor() {}
+	constexpr ImColor(float R, float G, float B, float A = 1.0f) : Value(R, G, B, A) {}
+	constexpr ImColor(const ImVec4& Color) : Value(Color) {}
+	ImColor(int R, int G, int B, int A = 255) : Value(static_cast<float>(R) / 255.0f, static_cast<float>(G) / 255.0f, static_cast<float>(B) / 255.0f, static_cast<float>(A) / 255.0f) {}
+	ImColor(ImU32 RGBA) : Value(static_cast<float>(RGBA & 0xFF) / 255.0f, static_cast<float>((RGBA >> 8) & 0xFF) / 255.0f, static_cast<float>((RGBA >> 16) & 0xFF) / 255.0f, static_cast<float>((RGBA >> 24) & 0xFF) / 255.0f) {}
+
+	inline operator ImVec4() const { return Value; }
+};
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace VisNodeSys
+{
+	// Unbounded lock-free queue with many producers and one consumer (Vyukov's node based queue).
+	// Push could be called from any thread and never waits, TryPop should only be called by consumer thread.
+	// Consumer could miss element while producer is between its two steps, that element is returned by later TryPop.
+	// Consumed nodes return to lock-free free list, so Push allocates only when queue holds more elements than ever before.
+	template<typename T>
+	class MPSCQueue
+	{
+		struct QueueNode
+		{
+			std::atomic<QueueNode*> Next;
+			// Index of next node in free list, valid only while node is in it.
+			std::atomic<uint32_t> NextFree;
+			uint32_t Index;
+			T Value;
+
+			QueueNode() : Next(nullptr), NextFree(0), Index(0), Value() {}
+		};
+
+		// Nodes live in chunks that are never moved, so free list could refer to them by index.
+		// Chunk k holds FirstChunkSize << k nodes, so chunks cover whole index range.
+		static const uint32_t FirstChunkSize = 256;
+		static const uint32_t MaxChunkCount = 24;
+		static const uint32_t NoIndex = UINT32_MAX;
+
+		// Producers and consumer touch different ends, padding keeps them on separate cache lines.
+		std::atomic<QueueNode*> Head;
+		char HeadPadding[64 - sizeof(std::atomic<QueueNode*>)];
+		// Node that was consumed last, its Next is first element.
+		QueueNode* Tail = nullptr;
+		char TailPadding[64 - sizeof(QueueNode*)];
+
+		// Lower half is index of first free node, upper half counts changes,
+		// so that producer notices when node it wanted to take was taken and returned meanwhile.
+		std::atomic<uint64_t> FreeList;
+		std::atomic<uint32_t> ChunkCount;
+		std::atomic<QueueNode*> Chunks[MaxChunkCount];
+
+		// Index of first node of chunk k is FirstChunkSize * (2^k - 1).
+		static uint32_t GetChunkIndex(const uint32_t Index)
+		{
+			uint32_t Scaled = Index / FirstChunkSize + 1;
+			uint32_t Result = 0;
+			for (uint32_t Shift = 16; Shift > 0; Shift /= 2)
+			{
+				if (Scaled >= (1u << Shift))
+				{
+					Scaled >>= Shift;
+					Result += Shift;
+				}
+			}
+
+			return Result;
+		}
+
+		static uint32_t GetFirstIndex(const uint32_t ChunkIndex)
+		{
+			return FirstChunkSize * ((1u << ChunkIndex) - 1);
+		}
+
+		QueueNode* GetNode(const uint32_t Index) const
+		{
+			const uint32_t ChunkIndex = GetChunkIndex(Index);
+			return &Chunks[ChunkIndex].load(std::memory_order_acquire)[Index - GetFirstIndex(ChunkIndex)];
+		}
+
+		void PushFree(QueueNode* First, QueueNode* Last)
+		{
+			uint64_t OldFreeList = FreeList.load(std::memory_order_relaxed);
+			uint64_t NewFreeList;
+			do
+			{
+				Last->NextFree.store(static_cast<uint32_t>(OldFreeList), std::memory_order_relaxed);
+				NewFreeList = (((OldFreeList >> 32) + 1) << 32) | First->Index;
+			} while (!FreeList.compare_exchange_weak(OldFreeList, NewFreeList, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		QueueNode* AllocateNode()
+		{
+			uint64_t OldFreeList = FreeList.load(std::memory_order_acquire);
+			while (static_cast<uint32_t>(OldFreeList) != NoIndex)
+			{
+				QueueNode* FreeNode = GetNode(static_cast<uint32_t>(OldFreeList));
+				const uint64_t NewFreeList = (((OldFreeList >> 32) + 1) << 32) | FreeNode->NextFree.load(std::memory_order_relaxed);
+				if (FreeList.compare_exchange_weak(OldFreeList, NewFreeList, std::memory_order_acquire, std::memory_order_acquire))
+					return FreeNode;
+			}
+
+			const uint32_t ChunkIndex = ChunkCount.load(std::memory_order_relaxed) < MaxChunkCount ? ChunkCount.fetch_add(1, std::memory_order_relaxed) : MaxChunkCount;
+			if (ChunkIndex >= MaxChunkCount)
+			{
+				QueueNode* NewNode = new QueueNode();
+				NewNode->Index = NoIndex;
+				return NewNode;
+			}
+
+			// First node of new chunk is used right away, the rest goes to free list.
+			const uint32_t NewChunkSize = FirstChunkSize << ChunkIndex;
+			QueueNode* NewChunk = new QueueNode[NewChunkSize];
+			for (uint32_t i = 0; i < NewChunkSize; i++)
+			{
+				NewChunk[i].Index = GetFirstIndex(ChunkIndex) + i;
+				NewChunk[i].NextFree.store(NewChunk[i].Index + 1, std::memory_order_relaxed);
+			}
+			Chunks[ChunkIndex].store(NewChunk, std::memory_order_release);
+			PushFree(&NewChunk[1], &NewChunk[NewChunkSize - 1]);
+
+			return &NewChunk[0];
+		}
+
+		void ReleaseNode(QueueNode* Node)
+		{
+			if (Node->Index == NoIndex)
+			{
+				delete Node;
+				return;
+			}
+
+			PushFree(Node, Node);
+		}
+	public:
+		MPSCQueue() : FreeList(NoIndex), ChunkCount(0)
+		{
+			for (uint32_t i = 0; i < MaxChunkCount; i++)
+				Chunks[i].store(nullptr, std::memory_order_relaxed);
+
+			Tail = AllocateNode();
+			Head.store(Tail, std::memory_order_relaxed);
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+		~MPSCQueue()
+		{
+			while (Tail != nullptr)
+			{
+				QueueNode* Next = Tail->Next.load(std::memory_order_relaxed);
+				if (Tail->Index == NoIndex)
+					delete Tail;
+				Tail = Next;
+			}
+
+			for (uint32_t i = 0; i < MaxChunkCount; i++)
+				delete[] Chunks[i].load(std::memory_order_relaxed);
+		}
+
+		void Push(const T& Value)
+		{
+			QueueNode* NewNode = AllocateNode();
+			NewNode->Value = Value;
+			NewNode->Next.store(nullptr, std::memory_order_relaxed);
+			QueueNode* PreviousHead = Head.exchange(NewNode, std::memory_order_acq_rel);
+			PreviousHead->Next.store(NewNode, std::memory_order_release);
+		}
+
+		bool TryPop(T& Value)
+		{
+			QueueNode* Next = Tail->Next.load(std::memory_order_acquire);
+			if (Next == nullptr)
+				return false;
+
+			Value = Next->Value;
+			ReleaseNode(Tail);
+			Tail = Next;
+			return true;
+		}
+
+		bool IsEmpty() const
+		{
+			return Tail->Next.load(std::memory_order_acquire) == nullptr;
+		}
+	};
+}
\ No newline at end of file
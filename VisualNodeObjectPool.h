@@ -0,0 +1,157 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace VisNodeSys
+{
+	// Chunked storage for small objects that are owned by a NodeArea (connections, reroute nodes).
+	// Objects never move once created, freed slots are reused through a freelist
+	// and all chunks are released at once when the pool is cleared or destroyed.
+	template<typename T>
+	class ObjectPool
+	{
+		struct Slot
+		{
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+			bool bAlive = false;
+		};
+
+		struct Chunk
+		{
+			std::unique_ptr<Slot[]> Slots;
+			size_t Size = 0;
+		};
+
+		static const size_t FirstChunkSize = 64;
+		static const size_t MaxChunkSize = 4096;
+
+		std::vector<Chunk> Chunks;
+		std::vector<Slot*> FreeSlots;
+		size_t LiveCount = 0;
+		size_t Capacity = 0;
+
+		void AddChunk()
+		{
+			size_t NewChunkSize = Chunks.empty() ? FirstChunkSize : Chunks.back().Size * 2;
+			if (NewChunkSize > MaxChunkSize)
+				NewChunkSize = MaxChunkSize;
+
+			AddChunk(NewChunkSize);
+		}
+
+		void AddChunk(const size_t NewChunkSize)
+		{
+			Chunk NewChunk;
+			NewChunk.Slots.reset(new Slot[NewChunkSize]);
+			NewChunk.Size = NewChunkSize;
+
+			FreeSlots.reserve(FreeSlots.size() + NewChunkSize);
+			// Reversed, so that slots are handed out in memory order.
+			for (size_t i = NewChunkSize; i > 0; i--)
+				FreeSlots.push_back(&NewChunk.Slots[i - 1]);
+
+			Capacity += NewChunkSize;
+			Chunks.push_back(std::move(NewChunk));
+		}
+
+		static Slot* ToSlot(T* Object)
+		{
+			return reinterpret_cast<Slot*>(Object);
+		}
+	public:
+		ObjectPool() {}
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool& operator=(const ObjectPool&) = delete;
+
+		~ObjectPool()
+		{
+			Clear();
+		}
+
+		template<typename... Args>
+		T* Create(Args&&... Arguments)
+		{
+			if (FreeSlots.empty())
+				AddChunk();
+
+			Slot* FreeSlot = FreeSlots.back();
+			T* Result = new (&FreeSlot->Storage) T(std::forward<Args>(Arguments)...);
+			FreeSlots.pop_back();
+			FreeSlot->bAlive = true;
+			LiveCount++;
+
+			return Result;
+		}
+
+		// Makes sure that next Count creations will not allocate.
+		void Reserve(const size_t Count)
+		{
+			if (FreeSlots.size() < Count)
+				AddChunk(Count - FreeSlots.size());
+		}
+
+		void Destroy(T* Object)
+		{
+			if (Object == nullptr)
+				return;
+
+			Slot* ObjectSlot = ToSlot(Object);
+			Object->~T();
+			ObjectSlot->bAlive = false;
+			FreeSlots.push_back(ObjectSlot);
+			LiveCount--;
+		}
+
+		// Destroys objects that are still alive and releases all chunks.
+		void Clear()
+		{
+			if (LiveCount > 0)
+			{
+				for (size_t i = 0; i < Chunks.size(); i++)
+				{
+					for (size_t j = 0; j < Chunks[i].Size; j++)
+					{
+						Slot& CurrentSlot = Chunks[i].Slots[j];
+						if (CurrentSlot.bAlive)
+						{
+							reinterpret_cast<T*>(&CurrentSlot.Storage)->~T();
+							CurrentSlot.bAlive = false;
+						}
+					}
+				}
+			}
+
+			Chunks.clear();
+			FreeSlots.clear();
+			LiveCount = 0;
+			Capacity = 0;
+		}
+
+		// Takes ownership of all objects and chunks of other pool, objects keep their addresses.
+		void Adopt(ObjectPool& Other)
+		{
+			if (&Other == this)
+				return;
+
+			for (size_t i = 0; i < Other.Chunks.size(); i++)
+				Chunks.push_back(std::move(Other.Chunks[i]));
+
+			FreeSlots.insert(FreeSlots.end(), Other.FreeSlots.begin(), Other.FreeSlots.end());
+			LiveCount += Other.LiveCount;
+			Capacity += Other.Capacity;
+
+			Other.Chunks.clear();
+			Other.FreeSlots.clear();
+			Other.LiveCount = 0;
+			Other.Capacity = 0;
+		}
+
+		size_t GetLiveCount() const { return LiveCount; }
+		size_t GetCapacity() const { return Capacity; }
+		size_t GetChunkCount() const { return Chunks.size(); }
+	};
+}
\ No newline at end of file
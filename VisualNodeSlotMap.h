@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace VisNodeSys
+{
+	// Weak reference to an element stored in SlotMap.
+	// Becomes invalid when element is removed, even if its slot is reused later.
+	struct SlotHandle
+	{
+		uint32_t Index = UINT32_MAX;
+		uint32_t Generation = 0;
+
+		bool IsNull() const { return Index == UINT32_MAX; }
+		bool operator==(const SlotHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+		bool operator!=(const SlotHandle& Other) const { return !(*this == Other); }
+	};
+
+	// Elements are kept densely packed for iteration, insert and remove are O(1).
+	// Remove moves the last element into the freed place, so order of elements is not preserved.
+	template<typename T>
+	class SlotMap
+	{
+		struct Slot
+		{
+			uint32_t ElementIndex = UINT32_MAX;
+			uint32_t Generation = 0;
+		};
+
+		std::vector<T*> Elements;
+		std::vector<uint32_t> ElementToSlot;
+		std::vector<Slot> Slots;
+		std::vector<uint32_t> FreeSlots;
+
+		void FreeSlot(const uint32_t SlotIndex)
+		{
+			Slots[SlotIndex].ElementIndex = UINT32_MAX;
+			Slots[SlotIndex].Generation++;
+			FreeSlots.push_back(SlotIndex);
+		}
+	public:
+		SlotHandle Insert(T* Element)
+		{
+			uint32_t SlotIndex;
+			if (!FreeSlots.empty())
+			{
+				SlotIndex = FreeSlots.back();
+				FreeSlots.pop_back();
+			}
+			else
+			{
+				SlotIndex = static_cast<uint32_t>(Slots.size());
+				Slots.push_back(Slot());
+			}
+
+			Slots[SlotIndex].ElementIndex = static_cast<uint32_t>(Elements.size());
+			Elements.push_back(Element);
+			ElementToSlot.push_back(SlotIndex);
+
+			SlotHandle Result;
+			Result.Index = SlotIndex;
+			Result.Generation = Slots[SlotIndex].Generation;
+			return Result;
+		}
+
+		bool Contains(const SlotHandle Handle) const
+		{
+			return Handle.Index < Slots.size() && Slots[Handle.Index].Generation == Handle.Generation && Slots[Handle.Index].ElementIndex != UINT32_MAX;
+		}
+
+		// Returns nullptr if handle is stale.
+		T* Get(const SlotHandle Handle) const
+		{
+			if (!Contains(Handle))
+				return nullptr;
+
+			return Elements[Slots[Handle.Index].ElementIndex];
+		}
+
+		bool Remove(const SlotHandle Handle)
+		{
+			if (!Contains(Handle))
+				return false;
+
+			const uint32_t ElementIndex = Slots[Handle.Index].ElementIndex;
+			const uint32_t LastElementIndex = static_cast<uint32_t>(Elements.size() - 1);
+			if (ElementIndex != LastElementIndex)
+			{
+				Elements[ElementIndex] = Elements[LastElementIndex];
+				ElementToSlot[ElementIndex] = ElementToSlot[LastElementIndex];
+				Slots[ElementToSlot[ElementIndex]].ElementIndex = ElementIndex;
+			}
+
+			Elements.pop_back();
+			ElementToSlot.pop_back();
+			FreeSlot(Handle.Index);
+
+			return true;
+		}
+
+		// Invalidates all handles, slots are kept for reuse.
+		void clear()
+		{
+			for (size_t i = 0; i < ElementToSlot.size(); i++)
+				FreeSlot(ElementToSlot[i]);
+
+			Elements.clear();
+			ElementToSlot.clear();
+		}
+
+		void reserve(const size_t Count)
+		{
+			Elements.reserve(Count);
+			ElementToSlot.reserve(Count);
+			Slots.reserve(Count);
+		}
+
+		// Position of element in dense storage, handle should be valid.
+		size_t GetElementIndex(const SlotHandle Handle) const
+		{
+			return Slots[Handle.Index].ElementIndex;
+		}
+
+		SlotHandle GetHandle(const size_t ElementIndex) const
+		{
+			SlotHandle Result;
+			Result.Index = ElementToSlot[ElementIndex];
+			Result.Generation = Slots[Result.Index].Generation;
+			return Result;
+		}
+
+		const std::vector<T*>& GetElements() const { return Elements; }
+
+		T* operator[](const size_t ElementIndex) const { return Elements[ElementIndex]; }
+		size_t size() const { return Elements.size(); }
+		bool empty() const { return Elements.empty(); }
+		T* back() const { return Elements.back(); }
+		typename std::vector<T*>::const_iterator begin() const { return Elements.begin(); }
+		typename std::vector<T*>::const_iterator end() const { return Elements.end(); }
+	};
+}
\ No newline at end of file
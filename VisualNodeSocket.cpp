@@ -1,8 +1,7 @@
 #include "VisualNodeSocket.h"
+#include "VisualNode.h"
 using namespace VisNodeSys;
 
-std::unordered_map<std::string, ImColor> NodeSocket::SocketTypeToColorAssosiations;
-
 NodeSocket::NodeSocket(Node* Parent, const std::string Type, const std::string Name, bool bOutput, std::function<void* ()> OutputDataFunction)
 {
 	this->Parent = Parent;
@@ -41,6 +40,101 @@ std::string NodeSocket::GetType() const
 void NodeSocket::SetFunctionToOutputData(std::function<void* ()> NewFunction)
 {
 	OutputData = NewFunction;
+	DataSlot.reset();
+}
+
+std::atomic<uint64_t> NodeSocket::DataRevision(1);
+
+void NodeSocket::InvalidateData()
+{
+	if (DataSlot == nullptr)
+		return;
+
+	std::lock_guard<std::recursive_mutex> Lock(DataSlot->Mutex);
+	DataSlot->bDirty = true;
+	DataRevision++;
+}
+
+bool NodeSocket::RefreshData()
+{
+	std::lock_guard<std::recursive_mutex> Lock(DataSlot->Mutex);
+	const uint64_t Revision = DataRevision.load();
+	// Second check is for cycles, value that is being refreshed is returned as it is.
+	if ((DataSlot->VerifiedAt == Revision && !DataSlot->bDirty) || DataSlot->bRefreshing)
+		return false;
+
+	DataSlot->bRefreshing = true;
+	bool bRecompute = DataSlot->bDirty;
+	if (!bRecompute && Parent != nullptr)
+	{
+		for (size_t i = 0; i < Parent->Input.size() && !bRecompute; i++)
+		{
+			const std::vector<NodeSocket*>& InputSockets = Parent->Input[i]->ConnectedSockets;
+			for (size_t j = 0; j < InputSockets.size(); j++)
+			{
+				// Without cache there is no way to know whether value changed.
+				if (InputSockets[j]->DataSlot == nullptr)
+				{
+					bRecompute = true;
+					break;
+				}
+
+				InputSockets[j]->RefreshData();
+				if (InputSockets[j]->DataSlot->ChangedAt > DataSlot->VerifiedAt)
+				{
+					bRecompute = true;
+					break;
+				}
+			}
+		}
+	}
+
+	if (bRecompute)
+	{
+		DataSlot->Compute();
+		DataSlot->bDirty = false;
+		DataSlot->ChangedAt = Revision;
+		DataSlot->Misses++;
+	}
+
+	DataSlot->VerifiedAt = Revision;
+	DataSlot->bRefreshing = false;
+	return bRecompute;
+}
+
+void* NodeSocket::GetData()
+{
+	if (DataSlot == nullptr)
+		return OutputData();
+
+	if (!RefreshData())
+		DataSlot->Hits++;
+
+	return DataSlot->GetValue();
+}
+
+uint64_t NodeSocket::GetDataVersion() const
+{
+	return DataSlot == nullptr ? 0 : DataSlot->ChangedAt;
+}
+
+size_t NodeSocket::GetDataCacheHits() const
+{
+	return DataSlot == nullptr ? 0 : DataSlot->Hits.load();
+}
+
+size_t NodeSocket::GetDataCacheMisses() const
+{
+	return DataSlot == nullptr ? 0 : DataSlot->Misses.load();
+}
+
+void NodeSocket::ResetDataCacheCounters()
+{
+	if (DataSlot == nullptr)
+		return;
+
+	DataSlot->Hits = 0;
+	DataSlot->Misses = 0;
 }
 
 Connection::Connection(NodeSocket* Out, NodeSocket* In)
@@ -49,8 +143,5 @@ Connection::Connection(NodeSocket* Out, NodeSocket* In)
 	this->In = In;
 }
 
-Connection::~Connection()
-{
-	for (size_t i = 0; i < RerouteNodes.size(); i++)
-		delete RerouteNodes[i];
-}
\ No newline at end of file
+// Reroute nodes are owned by the pool of NodeArea and are released there.
+Connection::~Connection() {}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "VisualNodeCore.h"
+#include "VisualNodeSlotMap.h"
 
 namespace VisNodeSys
 {
@@ -10,11 +11,86 @@ namespace VisNodeSys
 #define DEFAULT_NODE_SOCKET_MOUSE_HOVERED_CONNECTION_COLOR ImColor(220, 220, 220)
 
 	class Node;
+	class Connection;
+
+	// Cached value of output socket, with its type erased.
+	// ChangedAt is revision in which value was last computed, VerifiedAt is revision in which it was last known to be up to date.
+	struct SocketDataSlotBase
+	{
+		const void* TypeTag = nullptr;
+		size_t ValueSize = 0;
+		std::recursive_mutex Mutex;
+		uint64_t ChangedAt = 0;
+		uint64_t VerifiedAt = 0;
+		bool bDirty = true;
+		bool bRefreshing = false;
+		std::atomic<size_t> Hits;
+		std::atomic<size_t> Misses;
+
+		SocketDataSlotBase() : Hits(0), Misses(0) {}
+		virtual ~SocketDataSlotBase() {}
+		virtual void Compute() = 0;
+		virtual void* GetValue() = 0;
+		// Array of values for batch execution, its content is kept only while it does not need to grow.
+		virtual void* GetLanes(size_t LaneCount) = 0;
+		// Copy with the same function and value, it is dirty and its revisions and counters start from zero.
+		virtual SocketDataSlotBase* Clone() const = 0;
+	};
+
+	template<typename T>
+	struct SocketDataType
+	{
+		static const char Tag;
+	};
+
+	template<typename T>
+	const char SocketDataType<T>::Tag = 0;
+
+	template<typename T>
+	struct SocketDataSlot : SocketDataSlotBase
+	{
+		std::function<T()> Function;
+		T Value;
+		std::unique_ptr<T[]> Lanes;
+		size_t LaneCapacity = 0;
+
+		SocketDataSlot(std::function<T()> Function) : Function(Function), Value()
+		{
+			TypeTag = &SocketDataType<T>::Tag;
+			ValueSize = sizeof(T);
+		}
+
+		void Compute() override
+		{
+			// Without function value is written by NodeExecutionPlan.
+			if (Function)
+				Value = Function();
+		}
+		void* GetValue() override { return &Value; }
+		void* GetLanes(const size_t LaneCount) override
+		{
+			if (LaneCount > LaneCapacity)
+			{
+				Lanes.reset(new T[LaneCount]());
+				LaneCapacity = LaneCount;
+			}
+
+			return Lanes.get();
+		}
+		SocketDataSlotBase* Clone() const override
+		{
+			SocketDataSlot<T>* Result = new SocketDataSlot<T>(Function);
+			Result->Value = Value;
+			return Result;
+		}
+	};
 
 	class NodeSocket
 	{
 		friend class NodeSystem;
 		friend class NodeArea;
+		friend class NodeEvaluator;
+		friend class NodeExecutionPlan;
 		friend Node;
 
 		std::string ID;
@@ -22,10 +98,21 @@ namespace VisNodeSys
 		std::string Type;
 		std::string Name;
 		std::vector<NodeSocket*> ConnectedSockets;
-
-		static std::unordered_map<std::string, ImColor> SocketTypeToColorAssosiations;
+		// Connections of NodeArea that use this socket, so they could be found without scanning whole area.
+		std::vector<Connection*> Connections;
 
 		std::function<void* ()> OutputData = []() { return nullptr; };
+		// Present only for output sockets with typed data function.
+		std::unique_ptr<SocketDataSlotBase> DataSlot;
+		// Bumped by every invalidation, so that cached values could be verified without walking graph again in the same revision.
+		static std::atomic<uint64_t> DataRevision;
+		// Returns true if value was recomputed.
+		bool RefreshData();
+
+		// Socket events delivered to this socket during flush EventFlushIndex of NodeArea, and caller of last of them.
+		uint64_t EventFlushIndex = 0;
+		uint32_t EventDeliveryCount = 0;
+		NodeSocket* LastEventCaller = nullptr;
 	protected:
 		Node* Parent = nullptr;
 	public:
@@ -43,7 +130,37 @@ namespace VisNodeSys
 		bool isInput() const { return !bOutput; }
 
 		void SetFunctionToOutputData(std::function<void* ()> NewFunction);
-		void* GetData() { return OutputData(); }
+		// With typed data function GetData returns pointer to cached value.
+		// Value is computed again only if socket was invalidated or some output connected to inputs of parent node changed.
+		// Sockets with untyped function call it every time.
+		void* GetData();
+
+		// T should be default constructible and assignable.
+		// Empty function only provides storage, value is then written by NodeExecutionPlan.
+		template<typename T>
+		void SetDataFunction(std::function<T()> NewFunction)
+		{
+			DataSlot.reset(new SocketDataSlot<T>(NewFunction));
+			InvalidateData();
+		}
+
+		// Returns nullptr if socket does not have typed data function of type T.
+		template<typename T>
+		const T* GetValue()
+		{
+			if (DataSlot == nullptr || DataSlot->TypeTag != &SocketDataType<T>::Tag)
+				return nullptr;
+
+			return static_cast<const T*>(GetData());
+		}
+
+		// Should be called when value could change for other reasons than changed inputs of parent node.
+		void InvalidateData();
+		// Revision in which cached value was last computed, 0 if it was never computed.
+		uint64_t GetDataVersion() const;
+		size_t GetDataCacheHits() const;
+		size_t GetDataCacheMisses() const;
+		void ResetDataCacheCounters();
 	};
 
 	struct ConnectionStyle
@@ -69,8 +186,10 @@ namespace VisNodeSys
 		friend class NodeArea;
 		friend class Connection;
 		friend Node;
+		template<typename T> friend class ObjectPool;
 
 		std::string ID;
+		SlotHandle AreaHandle;
 		Connection* Parent = nullptr;
 		ImVec2 Position;
 
@@ -103,7 +222,9 @@ namespace VisNodeSys
 		friend class NodeSystem;
 		friend class NodeArea;
 		friend Node;
+		template<typename T> friend class ObjectPool;
 
+		SlotHandle AreaHandle;
 		NodeSocket* Out = nullptr;
 		NodeSocket* In = nullptr;
 
@@ -9,7 +9,9 @@ NodeSystem::~NodeSystem() {}
 void NodeSystem::Initialize(bool bTestMode)
 {
 	NODE_CORE.bIsInTestMode = bTestMode;
+#ifndef VISUAL_NODE_SYSTEM_HEADLESS
 	NODE_CORE.InitializeFonts();
+#endif
 }
 
 NodeArea* NodeSystem::CreateNodeArea()
@@ -38,43 +40,52 @@ void NodeSystem::MoveNodesTo(NodeArea* SourceNodeArea, NodeArea* TargetNodeArea,
 
 	for (size_t i = 0; i < SourceNodeArea->Nodes.size(); i++)
 	{
+		// Node specific event callbacks stay with source area.
+		SourceNodeArea->RemoveNodeEventCallbacksOf(SourceNodeArea->Nodes[i]);
+		// Completion of asynchronous work would be delivered by source area, so it is cancelled.
+		SourceNodeArea->CancelAsync(SourceNodeArea->Nodes[i]);
 		TargetNodeArea->AddNode(SourceNodeArea->Nodes[i]);
+		// Dirty node keeps its flag, so it should be flushed by target area.
+		if (SourceNodeArea->Nodes[i]->bDirty)
+			TargetNodeArea->DirtyNodes.push_back(SourceNodeArea->Nodes[i]->AreaHandle);
 	}
 	const size_t SourceNodeCount = SourceNodeArea->Nodes.size();
 	SourceNodeArea->Nodes.clear();
+	// Moved nodes were appended without regard to their connections.
+	TargetNodeArea->bTopologicalOrderDirty = true;
 
 	for (size_t i = 0; i < SourceNodeArea->Connections.size(); i++)
 	{
-		TargetNodeArea->Connections.push_back(SourceNodeArea->Connections[i]);
+		Connection* CurrentConnection = SourceNodeArea->Connections[i];
+		CurrentConnection->AreaHandle = TargetNodeArea->Connections.Insert(CurrentConnection);
+		for (size_t j = 0; j < CurrentConnection->RerouteNodes.size(); j++)
+		{
+			CurrentConnection->RerouteNodes[j]->AreaHandle = TargetNodeArea->AllRerouteNodes.Insert(CurrentConnection->RerouteNodes[j]);
+		}
 	}
 	SourceNodeArea->Connections.clear();
+	SourceNodeArea->AllRerouteNodes.clear();
+	TargetNodeArea->ConnectionPool.Adopt(SourceNodeArea->ConnectionPool);
+	TargetNodeArea->RerouteNodePool.Adopt(SourceNodeArea->RerouteNodePool);
 	SourceNodeArea->Clear();
 
 	// Select moved nodes.
 	if (SelectMovedNodes)
 	{
-		TargetNodeArea->SelectedNodes.clear();
+		TargetNodeArea->UnSelectAllNodes();
 		for (size_t i = TargetNodeArea->Nodes.size() - SourceNodeCount; i < TargetNodeArea->Nodes.size(); i++)
 		{
-			TargetNodeArea->SelectedNodes.push_back(TargetNodeArea->Nodes[i]);
+			TargetNodeArea->AddSelected(TargetNodeArea->Nodes[i]);
 		}
 	}
 }
 
 std::vector<std::pair<std::string, ImColor>> NodeSystem::GetAssociationsOfSocketTypeToColor(std::string SocketType, ImColor Color)
 {
-	std::vector<std::pair<std::string, ImColor>> Result;
-	auto iterator = NodeSocket::SocketTypeToColorAssosiations.begin();
-	while (iterator != NodeSocket::SocketTypeToColorAssosiations.end())
-	{
-		Result.push_back(std::make_pair(iterator->first, iterator->second));
-		iterator++;
-	}
-
-	return Result;
+	return NodeContext::GetDefault().GetAssociationsOfSocketTypeToColor();
 }
 
 void NodeSystem::AssociateSocketTypeToColor(std::string SocketType, ImColor Color)
 {
-	NodeSocket::SocketTypeToColorAssosiations[SocketType] = Color;
+	NodeContext::GetDefault().AssociateSocketTypeToColor(SocketType, Color);
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "SubSystems/VisualNodeArea/VisualNodeArea.h"
+#include "SubSystems/VisualNodeEvaluation/VisualNodeEvaluator.h"
+#include "SubSystems/VisualNodeEvaluation/VisualNodeExecutionPlan.h"
 
 namespace VisNodeSys
 {